@@ -0,0 +1,57 @@
+// Benchmark of a step of the disease automaton (diseaseGrid_step) on the biggest grid, 256x256
+// tiles, all of them hosts so the disease never runs out of tiles to spread to. A step has to
+// take less than DISEASE_BENCH_BUDGET_US, otherwise the benchmark fails.
+//
+// make bench-disease
+
+#include "../src/entity/disease_grid.h"
+#include <stdio.h>
+#include <time.h>
+
+#define DISEASE_BENCH_STEPS 2000
+#define DISEASE_BENCH_BUDGET_US 1000
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(void) {
+    static DiseaseGrid grid;
+
+    diseaseGrid_init(&grid, DISEASE_GRID_MAX_COLS, DISEASE_GRID_MAX_ROWS);
+
+    for (int y = 0; y < grid.rows; y++) {
+        for (int x = 0; x < grid.cols; x++) {
+            diseaseGrid_setHost(&grid, x, y);
+        }
+    }
+
+    for (int i = 0; i < 16; i++) {
+        diseaseGrid_infect(&grid, i * 37 % grid.cols, i * 91 % grid.rows);
+    }
+
+    int mostInfected = 0;
+    double start = now();
+
+    for (int i = 0; i < DISEASE_BENCH_STEPS; i++) {
+        diseaseGrid_step(&grid);
+
+        if (i % 100 == 0) {
+            int infected = diseaseGrid_countInfected(&grid);
+            mostInfected = infected > mostInfected ? infected : mostInfected;
+        }
+    }
+
+    double stepUs = (now() - start) / DISEASE_BENCH_STEPS * 1e6;
+
+    printf("%dx%d tiles, %d steps\n", grid.cols, grid.rows, DISEASE_BENCH_STEPS);
+    printf("    %.1f us per step (budget %d us)\n", stepUs, DISEASE_BENCH_BUDGET_US);
+    printf("    %d infected at most, %d at the end\n",
+        mostInfected,
+        diseaseGrid_countInfected(&grid));
+
+    return stepUs < DISEASE_BENCH_BUDGET_US ? 0 : 1;
+}
@@ -0,0 +1,183 @@
+// Determinism check of the garden simulation. Plays a scripted garden (planters full of plants,
+// random care, irrigation and roofs, a moving view, some long steps) with a fixed seed and fixed
+// steps, in both simulation modes, and hashes the state after every update (garden_getStateHash).
+//
+// make hash-record   before changing the simulation, writes the reference hashes
+// make hash-compare  after it, fails at the first update with a different state
+//
+// A rewrite that is meant to give the same results (vectors, threads, fixed point...) has to
+// pass the comparison
+
+#include "../src/core/job_pool.h"
+#include "../src/entity/garden.h"
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define HASH_UPDATES 20000
+
+static unsigned int seed;
+
+static unsigned int randomNumber() {
+    seed = seed * 1103515245 + 12345;
+
+    return seed >> 8;
+}
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void fillGarden(Garden *garden) {
+    for (int planterIndex = 0; planterIndex < GARDEN_MAX_TILES; planterIndex++) {
+        Vector2 coords = {planterIndex % 14, planterIndex / 14 % 12};
+        Planter planter;
+        planter_init(&planter, PLANTER_TYPE_2x2, coords, ROTATION_0, TILE_WIDTH);
+
+        // through the command, as the game does, so the sim sees the new planter
+        GardenCommand command = {GARDEN_COMMAND_SET_PLANTER, {.planter = {planterIndex, planter}}};
+        garden_runCommand(garden, &command);
+
+        for (int plantIndex = 0; plantIndex < PLANTER_MAX_PLANTS; plantIndex++) {
+            garden_addPlant(garden, planterIndex, plantIndex, randomNumber() % PLANT_TYPE_COUNT);
+        }
+    }
+}
+
+/// Plays the script, writing the hash of each update to `hashes`
+static void play(PlantSimulationMode mode, uint64_t *hashes, double *hashSeconds) {
+    static Garden garden;
+    Vector2 viewSize = {1920, 1080};
+
+    // from the morning, through noon and into the next days
+    double timeOfDay = 6 * 60 * 60;
+    int dayOfYear = 0;
+
+    seed = 12345;
+
+    garden_init(&garden, &viewSize, dayOfYear, timeOfDay);
+    garden_setPlantSimulationMode(&garden, mode);
+    fillGarden(&garden);
+
+    for (int i = 0; i < HASH_UPDATES; i++) {
+        if (i % 1500 == 0) {
+            SCENE_TRANSFORM.translation.x = (int)(randomNumber() % 6000) - 3000;
+            SCENE_TRANSFORM.translation.y = (int)(randomNumber() % 4000) - 2000;
+        }
+
+        if (i % 10 == 0) {
+            int planterIndex = randomNumber() % GARDEN_MAX_TILES;
+            int plantIndex = randomNumber() % PLANTER_MAX_PLANTS;
+
+            switch (randomNumber() % 4) {
+            case 0:
+                garden_feedPlant(&garden, planterIndex, plantIndex);
+                break;
+            case 1:
+                garden_removePlant(&garden, planterIndex, plantIndex);
+                garden_propagatePlant(&garden, planterIndex, plantIndex, PLANT_TYPE_CRASSULA_OVATA);
+                break;
+            default:
+                garden_irrigatePlant(&garden, planterIndex, plantIndex);
+                break;
+            }
+        }
+
+        if (i % 100 == 0) {
+            int x = randomNumber() % GARDEN_COLS;
+            int y = randomNumber() % GARDEN_ROWS;
+
+            garden_setIrrigationPiece(&garden, x, y, randomNumber() % IRRIGATION_PIECE_COUNT);
+
+            x = randomNumber() % GARDEN_COLS;
+            y = randomNumber() % GARDEN_ROWS;
+            garden_setRoof(&garden, x, y, randomNumber() % 2);
+        }
+
+        // time-lapse steps now and then
+        float deltaTime = i % 500 == 0 ? 37.25f : 1.0f / 60;
+
+        timeOfDay += deltaTime * GAME_SECONDS_PER_RL_SECONDS;
+
+        if (timeOfDay >= SECONDS_IN_A_DAY) {
+            timeOfDay -= SECONDS_IN_A_DAY;
+            dayOfYear = (dayOfYear + 1) % DAYS_IN_A_YEAR;
+        }
+
+        garden_update(&garden, deltaTime, dayOfYear, timeOfDay);
+
+        double start = now();
+        hashes[i] = garden_getStateHash(&garden);
+        *hashSeconds += now() - start;
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3 || (strcmp(argv[1], "record") != 0 && strcmp(argv[1], "compare") != 0)) {
+        fprintf(stderr, "usage: %s record|compare <hashes file>\n", argv[0]);
+        return 2;
+    }
+
+    bool record = strcmp(argv[1], "record") == 0;
+
+    static uint64_t hashes[2][HASH_UPDATES];
+    double hashSeconds = 0;
+
+    jobPool_init();
+    play(PLANT_SIMULATION_EVENTS, hashes[0], &hashSeconds);
+    play(PLANT_SIMULATION_TICKS, hashes[1], &hashSeconds);
+    jobPool_shutdown();
+
+    printf("%d updates, %.1f us per hash\n",
+        2 * HASH_UPDATES,
+        hashSeconds / (2 * HASH_UPDATES) * 1e6);
+
+    FILE *file = fopen(argv[2], record ? "w" : "r");
+
+    if (file == NULL) {
+        perror(argv[2]);
+        return 2;
+    }
+
+    const char *modeNames[] = {"ticks", "events"};
+    int modes[] = {PLANT_SIMULATION_EVENTS, PLANT_SIMULATION_TICKS};
+    int result = 0;
+
+    for (int run = 0; run < 2 && result == 0; run++) {
+        for (int i = 0; i < HASH_UPDATES; i++) {
+            if (record) {
+                fprintf(file, "%016" PRIx64 "\n", hashes[run][i]);
+                continue;
+            }
+
+            uint64_t expected;
+
+            if (fscanf(file, "%" SCNx64, &expected) != 1) {
+                fprintf(stderr, "%s: not enough hashes\n", argv[2]);
+                result = 2;
+                break;
+            }
+
+            if (hashes[run][i] != expected) {
+                printf("DIFFERENT: %s mode, update %d\n", modeNames[modes[run]], i);
+                result = 1;
+                break;
+            }
+        }
+    }
+
+    fclose(file);
+
+    if (record) {
+        printf("recorded in %s\n", argv[2]);
+    } else if (result == 0) {
+        printf("same states as %s\n", argv[2]);
+    }
+
+    return result;
+}
@@ -0,0 +1,169 @@
+// Benchmark of the vectorized plant update (plantStore_tick) against the scalar path
+// (plantStore_tickScalar). Both run from the same random plants and the results must be the same
+// bits, otherwise the benchmark fails. It fails too if the underfed plants of the store (see
+// PlantStore.underfed) aren't the ones below the optimal nutrition level of their own traits.
+//
+// make bench
+
+#include "../src/entity/plant.h"
+#include "../src/entity/plant_genome.h"
+#include "../src/entity/plant_store.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_TICKS 2000
+
+static unsigned int seed = 12345;
+
+static PlantStat randomStat() {
+    seed = seed * 1103515245 + 12345;
+
+    return (seed >> 8) % (PLANT_STAT_MAX + 1);
+}
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool storesAreEqual(const PlantStore *a, const PlantStore *b, int count) {
+    size_t size = count * sizeof(PlantStat);
+
+    return memcmp(a->health, b->health, size) == 0
+        && memcmp(a->hydration, b->hydration, size) == 0
+        && memcmp(a->nutrition, b->nutrition, size) == 0
+        && memcmp(a->mediumHydration, b->mediumHydration, size) == 0
+        && memcmp(a->mediumNutrition, b->mediumNutrition, size) == 0
+        && memcmp(a->biomass, b->biomass, count * sizeof(int)) == 0
+        && memcmp(&a->stats, &b->stats, sizeof(PlantStoreStats)) == 0;
+}
+
+/// Whether the underfed plants of the first `count` of the store, counted and found as the garden
+/// does, are the ones with the nutrition level below the optimal one of their traits
+static bool underfedIsRight(const PlantStore *store, int count) {
+    int underfedCount = 0;
+    int found = -1;
+
+    for (int i = 0; i < count; i++) {
+        int level = plant_getStatLevel(store->nutrition[i]);
+
+        if (level > PLANT_STATUS_LEVEL_COUNT - 1) {
+            level = PLANT_STATUS_LEVEL_COUNT - 1;
+        }
+
+        if (level >= store->traits[i].optimalNutritionLevel) {
+            continue;
+        }
+
+        underfedCount++;
+
+        // the plants are found in order, so the next one found has to be this one
+        found = plantStore_findUnderfed(store, found);
+
+        if (found != i) {
+            return false;
+        }
+    }
+
+    return plantStore_countUnderfed(store) == underfedCount;
+}
+
+/// A plant at the optimal nutrition level of its species, with a genome that takes its own one a
+/// level down and then a level up: only the second one is underfed
+static bool mutatedPlantsAreUnderfed(enum PlantType type) {
+    static PlantStore store;
+    const int levelGene = PLANT_GENE_NUTRITION_LEVEL * PLANT_GENE_BITS;
+    int level = plantDefinitions[type].optimalNutrientsLevel;
+
+    plantStore_init(&store);
+
+    for (int allele = 2; allele <= 3; allele++) {
+        Plant plant;
+        plant_initWithGenome(&plant, type, (PlantGenome)(allele << levelGene));
+        plant.nutrition = PLANT_STAT(PLANT_MAX_POINTS_FOR_LEVEL(level));
+        plantStore_set(&store, allele, &plant);
+    }
+
+    bool higherIsUnderfed = level < PLANT_STATUS_LEVEL_COUNT - 1;
+
+    return plantStore_countUnderfed(&store) == higherIsUnderfed
+        && plantStore_findUnderfed(&store, -1) == (higherIsUnderfed ? 2 : -1);
+}
+
+int main(void) {
+    static PlantStore scalarStore;
+    static PlantStore kernelStore;
+    static int plantIds[GARDEN_MAX_PLANTS];
+
+    bool allEqual = true;
+
+    for (int type = 0; type < PLANT_TYPE_COUNT; type++) {
+        plantStore_init(&scalarStore);
+
+        for (int i = 0; i < GARDEN_MAX_PLANTS; i++) {
+            // random genomes too, the traits change by lane
+            Plant plant;
+            plant_initWithGenome(&plant, type, randomStat() & PLANT_GENOME_BITS);
+
+            plant.mediumHydration = randomStat();
+            plant.mediumNutrition = randomStat();
+            plant.hydration = randomStat();
+            plant.nutrition = randomStat();
+            plant.health = randomStat();
+            plant.infected = randomStat() % 4 == 0;
+            plant.temperature = randomStat() % 3;
+            plant.light = randomStat() % 3;
+            plant.irrigation = randomStat() % 4 == 0 ? randomStat() % 5 : 0;
+
+            plantStore_set(&scalarStore, i, &plant);
+            plantIds[i] = i;
+        }
+
+        kernelStore = scalarStore;
+
+        double start = now();
+
+        for (int i = 0; i < BENCH_TICKS; i++) {
+            plantStore_tickScalar(&scalarStore, plantIds, GARDEN_MAX_PLANTS);
+        }
+
+        double scalarTime = now() - start;
+
+        start = now();
+
+        for (int i = 0; i < BENCH_TICKS; i++) {
+            plantStore_tick(&kernelStore, type, plantIds, GARDEN_MAX_PLANTS);
+        }
+
+        double kernelTime = now() - start;
+
+        bool equal = storesAreEqual(&scalarStore, &kernelStore, GARDEN_MAX_PLANTS);
+        allEqual = allEqual && equal;
+
+        bool underfedRight = underfedIsRight(&scalarStore, GARDEN_MAX_PLANTS)
+                          && underfedIsRight(&kernelStore, GARDEN_MAX_PLANTS)
+                          && mutatedPlantsAreUnderfed(type);
+        allEqual = allEqual && underfedRight;
+
+        double plantTicks = (double)BENCH_TICKS * GARDEN_MAX_PLANTS;
+
+        printf("%s (%d plants x %d ticks)\n",
+            plantDefinitions[type].name,
+            GARDEN_MAX_PLANTS,
+            BENCH_TICKS);
+        printf("    scalar: %8.2f ms  %7.1f Mticks/s\n",
+            scalarTime * 1e3,
+            plantTicks / scalarTime / 1e6);
+        printf("    kernel: %8.2f ms  %7.1f Mticks/s  (x%.1f)\n",
+            kernelTime * 1e3,
+            plantTicks / kernelTime / 1e6,
+            scalarTime / kernelTime);
+        printf("    results: %s\n", equal ? "identical" : "DIFFERENT");
+        printf("    underfed: %s\n", underfedRight ? "right" : "WRONG");
+    }
+
+    return allEqual ? 0 : 1;
+}
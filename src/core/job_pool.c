@@ -0,0 +1,257 @@
+#include "job_pool.h"
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+// Work stealing: a range is submitted as a single job to the queue of the thread that submits it
+// (the sim thread). A thread that takes a job bigger than a batch splits it in halves, pushes the
+// second half to the bottom of its own queue and goes on with the first, until it is down to a
+// batch. Each thread takes jobs from the bottom of its own queue (the last, smallest halves) and,
+// when it runs out, steals from the top of the queue of another thread (the oldest, biggest
+// ones), which it splits into its own queue in turn. The submitting thread works too while it
+// waits for the jobs.
+
+typedef struct {
+    Job jobs[JOB_POOL_QUEUE_CAPACITY];
+    /// index of the oldest job, where thieves take from
+    int top;
+    /// index after the newest job, where the owner pushes and takes from
+    int bottom;
+    pthread_mutex_t lock;
+} JobQueue;
+
+typedef struct {
+    pthread_t threads[JOB_POOL_MAX_WORKERS];
+    /// a queue per worker and the last one for the submitting thread
+    JobQueue queues[JOB_POOL_MAX_WORKERS + 1];
+    int workersCount;
+    /// items submitted and not done yet
+    atomic_int pendingItems;
+    /// to let sleeping workers know there is new work
+    int generation;
+    bool shuttingDown;
+    pthread_mutex_t sleepLock;
+    pthread_cond_t wakeUp;
+} JobPool;
+
+static JobPool pool;
+
+static JobQueue *getSubmitterQueue() {
+    return &pool.queues[pool.workersCount];
+}
+
+static bool push(JobQueue *queue, Job job) {
+    pthread_mutex_lock(&queue->lock);
+
+    bool pushed = queue->bottom - queue->top < JOB_POOL_QUEUE_CAPACITY;
+
+    if (pushed) {
+        queue->jobs[queue->bottom % JOB_POOL_QUEUE_CAPACITY] = job;
+        queue->bottom++;
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return pushed;
+}
+
+static bool pop(JobQueue *queue, Job *job) {
+    pthread_mutex_lock(&queue->lock);
+
+    bool popped = queue->bottom > queue->top;
+
+    if (popped) {
+        queue->bottom--;
+        *job = queue->jobs[queue->bottom % JOB_POOL_QUEUE_CAPACITY];
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return popped;
+}
+
+static bool steal(JobQueue *queue, Job *job) {
+    pthread_mutex_lock(&queue->lock);
+
+    bool stolen = queue->bottom > queue->top;
+
+    if (stolen) {
+        *job = queue->jobs[queue->top % JOB_POOL_QUEUE_CAPACITY];
+        queue->top++;
+    }
+
+    pthread_mutex_unlock(&queue->lock);
+
+    return stolen;
+}
+
+/// Takes a job from the own queue, or steals one from the others starting by the next queue
+static bool findJob(int queueIndex, Job *job) {
+    if (pop(&pool.queues[queueIndex], job)) {
+        return true;
+    }
+
+    int queuesCount = pool.workersCount + 1;
+
+    for (int i = 1; i < queuesCount; i++) {
+        if (steal(&pool.queues[(queueIndex + i) % queuesCount], job)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// Splits the job down to a batch, the halves it leaves go to the bottom of the queue of the thread
+/// for it or for others to take, and runs the batch
+static void runJob(int queueIndex, Job job) {
+    while (job.count > job.batchSize) {
+        // halves of whole batches, so the calls get the same ranges however the job is split
+        int batches = (job.count + job.batchSize - 1) / job.batchSize;
+        int firstHalf = batches / 2 * job.batchSize;
+
+        Job secondHalf = job;
+        secondHalf.first += firstHalf;
+        secondHalf.count -= firstHalf;
+
+        // no room left: this thread does all of it
+        if (!push(&pool.queues[queueIndex], secondHalf)) {
+            break;
+        }
+
+        job.count = firstHalf;
+    }
+
+    for (int first = job.first; first < job.first + job.count; first += job.batchSize) {
+        int left = job.first + job.count - first;
+        job.function(job.context, first, left < job.batchSize ? left : job.batchSize);
+    }
+
+    atomic_fetch_sub(&pool.pendingItems, job.count);
+}
+
+static void *workerLoop(void *arg) {
+    int queueIndex = (int)(long)arg;
+
+    while (true) {
+        pthread_mutex_lock(&pool.sleepLock);
+        int generation = pool.generation;
+        bool shuttingDown = pool.shuttingDown;
+        pthread_mutex_unlock(&pool.sleepLock);
+
+        if (shuttingDown) {
+            return NULL;
+        }
+
+        Job job;
+        while (findJob(queueIndex, &job)) {
+            runJob(queueIndex, job);
+        }
+
+        // sleep until something is submitted after the queues were checked
+        pthread_mutex_lock(&pool.sleepLock);
+
+        while (pool.generation == generation && !pool.shuttingDown) {
+            pthread_cond_wait(&pool.wakeUp, &pool.sleepLock);
+        }
+
+        pthread_mutex_unlock(&pool.sleepLock);
+    }
+}
+
+/// Starts a worker per extra core. With a single core everything runs on the submitting thread
+void jobPool_init() {
+    int cores = sysconf(_SC_NPROCESSORS_ONLN);
+
+    pool.workersCount = cores - 1;
+
+    if (pool.workersCount < 0) {
+        pool.workersCount = 0;
+    } else if (pool.workersCount > JOB_POOL_MAX_WORKERS) {
+        pool.workersCount = JOB_POOL_MAX_WORKERS;
+    }
+
+    atomic_init(&pool.pendingItems, 0);
+    pool.generation = 0;
+    pool.shuttingDown = false;
+    pthread_mutex_init(&pool.sleepLock, NULL);
+    pthread_cond_init(&pool.wakeUp, NULL);
+
+    for (int i = 0; i <= pool.workersCount; i++) {
+        pool.queues[i].top = 0;
+        pool.queues[i].bottom = 0;
+        pthread_mutex_init(&pool.queues[i].lock, NULL);
+    }
+
+    for (int i = 0; i < pool.workersCount; i++) {
+        if (pthread_create(&pool.threads[i], NULL, workerLoop, (void *)(long)i) != 0) {
+            // keep the workers that could be started
+            pool.workersCount = i;
+            break;
+        }
+    }
+}
+
+void jobPool_shutdown() {
+    pthread_mutex_lock(&pool.sleepLock);
+    pool.shuttingDown = true;
+    pthread_cond_broadcast(&pool.wakeUp);
+    pthread_mutex_unlock(&pool.sleepLock);
+
+    for (int i = 0; i < pool.workersCount; i++) {
+        pthread_join(pool.threads[i], NULL);
+    }
+
+    pool.workersCount = 0;
+}
+
+int jobPool_getWorkersCount() {
+    return pool.workersCount;
+}
+
+/// Submits [0, count) to be done in calls of up to `batchSize` items, always the same ranges
+/// [i * batchSize, (i + 1) * batchSize). Only one thread can submit (the one running the plant
+/// simulation), and the jobs are done when jobPool_wait returns
+void jobPool_submitRange(JobFunction function, void *context, int count, int batchSize) {
+    assert(batchSize > 0);
+
+    if (count <= 0) {
+        return;
+    }
+
+    Job job = {
+        .function = function,
+        .context = context,
+        .first = 0,
+        .count = count,
+        .batchSize = batchSize,
+    };
+
+    atomic_fetch_add(&pool.pendingItems, count);
+
+    // no room left: do it now
+    if (!push(getSubmitterQueue(), job)) {
+        runJob(pool.workersCount, job);
+    }
+
+    pthread_mutex_lock(&pool.sleepLock);
+    pool.generation++;
+    pthread_cond_broadcast(&pool.wakeUp);
+    pthread_mutex_unlock(&pool.sleepLock);
+}
+
+/// Helps with the submitted jobs until all of them are done
+void jobPool_wait() {
+    Job job;
+
+    while (atomic_load(&pool.pendingItems) > 0) {
+        if (findJob(pool.workersCount, &job)) {
+            runJob(pool.workersCount, job);
+        } else {
+            // the last jobs are running on the workers
+            sched_yield();
+        }
+    }
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdbool.h>
+
+#define JOB_POOL_MAX_WORKERS 15
+#define JOB_POOL_QUEUE_CAPACITY 256
+
+/// Works on the items [first, first + count) of whatever `context` points to
+typedef void (*JobFunction)(void *context, int first, int count);
+
+typedef struct {
+    JobFunction function;
+    void *context;
+    int first;
+    int count;
+    /// most items a call of `function` gets, bigger jobs are split before they run
+    int batchSize;
+} Job;
+
+void jobPool_init();
+void jobPool_shutdown();
+int jobPool_getWorkersCount();
+void jobPool_submitRange(JobFunction function, void *context, int count, int batchSize);
+void jobPool_wait();
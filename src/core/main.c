@@ -1,5 +1,6 @@
 #include "../game/game.h"
 #include "asset_manager.h"
+#include "job_pool.h"
 #include "raylib.h"
 
 int main(void) {
@@ -12,8 +13,10 @@ int main(void) {
     SetExitKey(KEY_NULL);
 
     assetManager_loadAssets();
+    jobPool_init();
 
-    Game g;
+    // a few hundred KB (the garden keeps every plant), too much for the stack on some platforms
+    static Game g;
     game_init(&g);
 
     /*
@@ -27,6 +30,9 @@ int main(void) {
         game_draw(&g);
     }
 
+    game_shutdown(&g);
+    jobPool_shutdown();
+
     // Should we?
     assetManager_unloadAssets();
 
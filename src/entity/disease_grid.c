@@ -0,0 +1,140 @@
+#include "disease_grid.h"
+#include "../utils/utils.h"
+#include <assert.h>
+#include <string.h>
+
+static const uint64_t emptyRow[DISEASE_GRID_MAX_ROW_WORDS] = {0};
+
+void diseaseGrid_init(DiseaseGrid *grid, int cols, int rows) {
+    assert(cols > 0 && cols <= DISEASE_GRID_MAX_COLS);
+    assert(rows > 0 && rows <= DISEASE_GRID_MAX_ROWS);
+
+    grid->cols = cols;
+    grid->rows = rows;
+    grid->rowWords = (cols + 63) / 64;
+    grid->current = 0;
+    grid->random = 0;
+
+    memset(grid->infected, 0, sizeof(grid->infected));
+    memset(grid->susceptible, 0, sizeof(grid->susceptible));
+    memset(grid->hosts, 0, sizeof(grid->hosts));
+
+    // every tile starts susceptible
+    for (int y = 0; y < rows; y++) {
+        for (int x = 0; x < cols; x++) {
+            grid->susceptible[0][y][x / 64] |= (uint64_t)1 << (x % 64);
+        }
+    }
+
+    memcpy(grid->susceptible[1], grid->susceptible[0], sizeof(grid->susceptible[0]));
+}
+
+static bool isInGrid(const DiseaseGrid *grid, int x, int y) {
+    return x >= 0 && x < grid->cols && y >= 0 && y < grid->rows;
+}
+
+void diseaseGrid_clearHosts(DiseaseGrid *grid) {
+    memset(grid->hosts, 0, sizeof(grid->hosts));
+}
+
+/// Makes the tile a host. Out of the grid does nothing
+void diseaseGrid_setHost(DiseaseGrid *grid, int x, int y) {
+    if (isInGrid(grid, x, y)) {
+        grid->hosts[y][x / 64] |= (uint64_t)1 << (x % 64);
+    }
+}
+
+/// Infects the tile if it is a host
+void diseaseGrid_infect(DiseaseGrid *grid, int x, int y) {
+    if (!isInGrid(grid, x, y)) {
+        return;
+    }
+
+    uint64_t bit = (uint64_t)1 << (x % 64);
+
+    if (grid->hosts[y][x / 64] & bit) {
+        grid->infected[grid->current][y][x / 64] |= bit;
+        grid->susceptible[grid->current][y][x / 64] &= ~bit;
+    }
+}
+
+bool diseaseGrid_isInfected(const DiseaseGrid *grid, int x, int y) {
+    if (!isInGrid(grid, x, y)) {
+        return false;
+    }
+
+    return grid->infected[grid->current][y][x / 64] >> (x % 64) & 1;
+}
+
+int diseaseGrid_countInfected(const DiseaseGrid *grid) {
+    int count = 0;
+
+    for (int y = 0; y < grid->rows; y++) {
+        for (int i = 0; i < grid->rowWords; i++) {
+            count += __builtin_popcountll(grid->infected[grid->current][y][i]);
+        }
+    }
+
+    return count;
+}
+
+/// A word with each bit set with a chance of 1 in 2^`bits`
+static uint64_t getChanceBits(DiseaseGrid *grid, int bits) {
+    uint64_t word = utils_random(&grid->random);
+
+    for (int i = 1; i < bits; i++) {
+        word &= utils_random(&grid->random);
+    }
+
+    return word;
+}
+
+/// One step of the automaton, from the current buffer to the other one
+void diseaseGrid_step(DiseaseGrid *grid) {
+    const int from = grid->current;
+    const int to = 1 - from;
+    const int words = grid->rowWords;
+
+    for (int y = 0; y < grid->rows; y++) {
+        const uint64_t *infected = grid->infected[from][y];
+        const uint64_t *above = y > 0 ? grid->infected[from][y - 1] : emptyRow;
+        const uint64_t *below = y + 1 < grid->rows ? grid->infected[from][y + 1] : emptyRow;
+
+        for (int i = 0; i < words; i++) {
+            // infected tile to the left and to the right of each bit, across words
+            uint64_t left = infected[i] << 1 | (i > 0 ? infected[i - 1] >> 63 : 0);
+            uint64_t right = infected[i] >> 1 | (i + 1 < words ? infected[i + 1] << 63 : 0);
+            uint64_t exposed = left | right | above[i] | below[i];
+
+            uint64_t hosts = grid->hosts[y][i];
+            uint64_t susceptible = grid->susceptible[from][y][i];
+            uint64_t immune = ~susceptible & ~infected[i];
+
+            uint64_t caught
+                = exposed & susceptible & hosts & getChanceBits(grid, DISEASE_SPREAD_CHANCE_BITS);
+            uint64_t recovered = infected[i] & getChanceBits(grid, DISEASE_RECOVERY_CHANCE_BITS);
+            uint64_t lostImmunity
+                = immune & getChanceBits(grid, DISEASE_IMMUNITY_LOSS_CHANCE_BITS);
+
+            grid->infected[to][y][i] = ((infected[i] & ~recovered) | caught) & hosts;
+            // a tile that stops being a host while infected is left immune
+            grid->susceptible[to][y][i] = (susceptible & ~caught) | lostImmunity;
+        }
+    }
+
+    grid->current = to;
+
+    uint64_t outbreak = utils_random(&grid->random);
+
+    if ((outbreak & ((1 << DISEASE_OUTBREAK_CHANCE_BITS) - 1)) != 0) {
+        return;
+    }
+
+    int tile = (outbreak >> 32) % (grid->cols * grid->rows);
+    int x = tile % grid->cols;
+    int y = tile / grid->cols;
+
+    if (grid->susceptible[to][y][x / 64] >> (x % 64) & 1) {
+        diseaseGrid_infect(grid, x, y);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Diseases and pests: a stochastic cellular automaton over the tiles of the garden. A tile is a
+// bit in each bitset, 64 tiles to a word, and a step works out the next state of a whole word with
+// a few bit operations: the infected neighbors are the infected bits shifted one tile each way,
+// and the chances are random words ANDed together. The state is double buffered, a step reads one
+// buffer and writes the other.
+// An infected tile catches the disease to the susceptible hosts next to it, and gets over it now
+// and then. A tile that got over it is immune (neither infected nor susceptible) for a while
+
+#define DISEASE_GRID_MAX_COLS 256
+#define DISEASE_GRID_MAX_ROWS 256
+#define DISEASE_GRID_MAX_ROW_WORDS (DISEASE_GRID_MAX_COLS / 64)
+
+// chances per step, of 1 in 2^bits
+/// of a susceptible host next to an infected tile of catching it
+#define DISEASE_SPREAD_CHANCE_BITS 2
+/// of an infected tile of getting over it
+#define DISEASE_RECOVERY_CHANCE_BITS 4
+/// of an immune tile of being susceptible again
+#define DISEASE_IMMUNITY_LOSS_CHANCE_BITS 5
+/// of the disease breaking out in a random tile of the grid
+#define DISEASE_OUTBREAK_CHANCE_BITS 8
+
+typedef struct {
+    int cols;
+    int rows;
+    /// words of a row in use
+    int rowWords;
+    /// buffer of `infected` and `susceptible` with the current state
+    int current;
+    uint64_t infected[2][DISEASE_GRID_MAX_ROWS][DISEASE_GRID_MAX_ROW_WORDS];
+    uint64_t susceptible[2][DISEASE_GRID_MAX_ROWS][DISEASE_GRID_MAX_ROW_WORDS];
+    /// tiles with something to infect, set by the owner of the grid. The rest can't catch it and
+    /// stop being infected
+    uint64_t hosts[DISEASE_GRID_MAX_ROWS][DISEASE_GRID_MAX_ROW_WORDS];
+    /// state of the random numbers, so a grid steps the same every run
+    uint64_t random;
+} DiseaseGrid;
+
+void diseaseGrid_init(DiseaseGrid *grid, int cols, int rows);
+void diseaseGrid_clearHosts(DiseaseGrid *grid);
+void diseaseGrid_setHost(DiseaseGrid *grid, int x, int y);
+void diseaseGrid_infect(DiseaseGrid *grid, int x, int y);
+bool diseaseGrid_isInfected(const DiseaseGrid *grid, int x, int y);
+int diseaseGrid_countInfected(const DiseaseGrid *grid);
+void diseaseGrid_step(DiseaseGrid *grid);
@@ -1,18 +1,21 @@
 #include "garden.h"
-#include "../core/asset_manager.h"
+#include "../core/job_pool.h"
 #include "../game/constants.h"
 #include "../game/gameplay.h"
 #include "plant.h"
+#include "plant_genome.h"
 #include "planter.h"
 #include <assert.h>
 #include <math.h>
-#include <raylib.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
-#define LIGHT_SOURCE_RADIUS 40
+/// cap of the segments searched for the event of a plant. Only a plant whose stats don't move gets
+/// there, it just gets its event at the cap
+#define PLANT_SEGMENT_MAX_TICKS (1L << 24)
 
 typedef struct {
     Vector2 vertices[4];
@@ -23,35 +26,24 @@ float lerp(float start, float stop, float amount) {
     return start + (stop - start) * amount;
 }
 
-/// `timeOfDay` is the % of the day passed
-float getLightSourceHeight(float timeOfDay) {
-    // 4x^2 - x
-    // because:
-    // x = 0 (sunrise) => y = 0
-    // x = 1 (sunset) => y = 0
-    // x = 0.5 (noon) => y = 0.5
-    return 4.0f * timeOfDay * -(1.0f - timeOfDay);
-}
+/// highest the light goes over the garden, in pixels, with the sun at an elevation of 1
+#define LIGHT_SOURCE_MAX_HEIGHT 256
+/// the path of the light is turned 25 degrees to go over the garden
+#define LIGHT_SOURCE_PATH_COS 0.906308f
+#define LIGHT_SOURCE_PATH_SIN 0.422618f
 
-Vector2 getLightSourcePosition(Garden *garden, int gameplayTime) {
-    float timeOfDay = (float)gameplayTime / (float)SECONDS_IN_A_DAY;
-    int maxHeight = 256;
+Vector2 getLightSourcePosition(Garden *garden, int dayOfYear, float gameplayTime) {
+    SunPosition sun = sunPath_getPosition(&garden->sunPath, dayOfYear, gameplayTime);
 
-    // position in a 1x1 universe
+    // scale and translate
     Vector2 v = {
-        lerp(0, 1, timeOfDay),
-        getLightSourceHeight(timeOfDay),
+        sun.across * GARDEN_COLS * TILE_WIDTH,
+        -sun.elevation * LIGHT_SOURCE_MAX_HEIGHT,
     };
 
-    // scale and translate
-    v.x *= (GARDEN_COLS)*TILE_WIDTH;
-    v.y *= maxHeight;
-
-    float rad = 25 * (M_PI / 180);
-
     Vector2 rotated = {
-        v.x * cos(rad) - v.y * sin(rad),
-        v.y * cos(rad) + v.x * sin(rad),
+        v.x * LIGHT_SOURCE_PATH_COS - v.y * LIGHT_SOURCE_PATH_SIN,
+        v.y * LIGHT_SOURCE_PATH_COS + v.x * LIGHT_SOURCE_PATH_SIN,
     };
 
     rotated.x += SCENE_TRANSFORM.translation.x + TILE_WIDTH;
@@ -60,7 +52,7 @@ Vector2 getLightSourcePosition(Garden *garden, int gameplayTime) {
     return rotated;
 }
 
-IsoRec getGardenIsoVertices(Garden *garden) {
+IsoRec garden_getIsoVertices(const Garden *garden) {
     IsoRec isoRec = grid_toIsoRec(&SCENE_TRANSFORM,
         (Vector2){0, 0},
         (Vector2){GARDEN_COLS, GARDEN_ROWS},
@@ -70,62 +62,7 @@ IsoRec getGardenIsoVertices(Garden *garden) {
     return isoRec;
 }
 
-IsoRec getHoveredIsoVertices(
-    const Garden *garden, int tileIndex, enum GardeningTool tool, int toolVariant) {
-
-    Vector2 coords = grid_getCoordsFromTileIndex(GARDEN_COLS, tileIndex);
-    Vector2 dimensions = {1, 1};
-
-    if (tool == GARDENING_TOOL_PLANTER) {
-        dimensions = planter_getFootPrint(toolVariant, garden->selectionRotation);
-
-    } else if (tool == GARDENING_TOOL_NONE && garden->planterPickedUpIndex != -1) {
-        const Planter *p = &garden->planters[garden->planterPickedUpIndex];
-        dimensions = planter_getFootPrint(p->type, garden->selectionRotation);
-
-    } else if (garden->tiles[tileIndex].planterIndex != -1) {
-        const Planter *p = &garden->planters[garden->tiles[tileIndex].planterIndex];
-        dimensions = planter_getFootPrint(p->type, p->rotation);
-        coords = p->coords;
-    }
-
-    IsoRec isoRec = grid_toIsoRec(&SCENE_TRANSFORM, coords, dimensions, TILE_WIDTH, TILE_HEIGHT);
-
-    return isoRec;
-}
-
-IsoRec getPlanterIsoVertices(const Garden *garden, int tileIndex) {
-    int planterIndex = garden->tiles[tileIndex].planterIndex;
-    const Planter *p = &garden->planters[planterIndex];
-
-    IsoRec isoRec = grid_toIsoRec(&SCENE_TRANSFORM,
-        p->coords,
-        planter_getFootPrint(p->type, p->rotation),
-        TILE_WIDTH,
-        TILE_HEIGHT);
-
-    return isoRec;
-}
-
-Vector2 getPlanterWorldPos(Garden *garden, Vector2 planterCoords) {
-    int tileIndex
-        = grid_getTileIndexFromCoords(GARDEN_COLS, GARDEN_ROWS, planterCoords.x, planterCoords.y);
-
-    IsoRec irec = getPlanterIsoVertices(garden, tileIndex);
-
-    return (Vector2){irec.left.x, irec.left.y};
-}
-
-Vector2 getPlanterDrawPos(Garden *garden, Vector2 planterCoords) {
-    int tileIndex
-        = grid_getTileIndexFromCoords(GARDEN_COLS, GARDEN_ROWS, planterCoords.x, planterCoords.y);
-
-    IsoRec planterRec = getPlanterIsoVertices(garden, tileIndex);
-
-    return (Vector2){planterRec.left.x, planterRec.top.y};
-}
-
-IsoRec getTileIsoVertices(const Garden *garden, int tileIndex) {
+IsoRec garden_getTileIsoVertices(const Garden *garden, int tileIndex) {
     Vector2 coords = grid_getCoordsFromTileIndex(GARDEN_COLS, tileIndex);
 
     IsoRec isoRec
@@ -160,13 +97,13 @@ void garden_updateGardenOrigin(Garden *garden, Vector2 *screenSize) {
 
     // TODO: if moved (as in, not centered, update based on scale)
     if (SCENE_TRANSFORM.scale == GARDEN_SCALE_INITIAL) {
-        target = getGardenIsoVertices(garden);
+        target = garden_getIsoVertices(garden);
     } else if (garden->tileHovered != -1) {
-        target = getTileIsoVertices(garden, garden->tileHovered);
+        target = garden_getTileIsoVertices(garden, garden->tileHovered);
     } else if (garden->tileSelected != -1) {
-        target = getTileIsoVertices(garden, garden->tileSelected);
+        target = garden_getTileIsoVertices(garden, garden->tileSelected);
     } else {
-        target = getGardenIsoVertices(garden);
+        target = garden_getIsoVertices(garden);
     }
 
     SCENE_TRANSFORM.translation.x = (screenSize->x - target.right.x - target.left.x) / 2;
@@ -178,7 +115,29 @@ int grid_getTilesCount(TileGrid *grid) {
     return grid->cols * grid->rows;
 }
 
-void garden_init(Garden *garden, Vector2 *screenSize, float gameplayTime) {
+/// Hashes the planter again after a change. The fields one by one, since they have padding
+static void rehashPlanter(Garden *garden, int planterIndex) {
+    const Planter *p = &garden->planters[planterIndex];
+    float fields[] = {
+        p->type,
+        p->exists,
+        p->plantGrid.cols,
+        p->plantGrid.rows,
+        p->plantGrid.tileWidth,
+        p->plantGrid.tileHeight,
+        p->plantGrid.tileCount,
+        p->coords.x,
+        p->coords.y,
+        p->rotation,
+    };
+
+    uint64_t hash = utils_hash(planterIndex, fields, sizeof(fields));
+
+    garden->plantersHash ^= garden->planterHash[planterIndex] ^ hash;
+    garden->planterHash[planterIndex] = hash;
+}
+
+void garden_init(Garden *garden, Vector2 *screenSize, int dayOfYear, float gameplayTime) {
     garden->planterPickedUpIndex = -1;
 
     garden->lightSourceLevel = 12;
@@ -195,15 +154,58 @@ void garden_init(Garden *garden, Vector2 *screenSize, float gameplayTime) {
 
     garden_updateGardenOrigin(garden, screenSize);
 
+    memset(garden->planterHash, 0, sizeof(garden->planterHash));
+    garden->plantersHash = 0;
+
     for (int i = 0; i < GARDEN_MAX_TILES; i++) {
         planter_empty(&garden->planters[i]);
+        rehashPlanter(garden, i);
     }
 
     for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
         garden->tiles[i].planterIndex = -1;
     }
 
-    garden->lightSourcePos = getLightSourcePosition(garden, gameplayTime);
+    plantStore_init(&garden->plants);
+    plantScheduler_init(&garden->plantScheduler);
+    plantEventQueue_init(&garden->plantEvents);
+    garden->plantSimulationMode = PLANT_SIMULATION_EVENTS;
+
+    garden->viewSize = *screenSize;
+    garden->lodMaxLag = GARDEN_LOD_MAX_LAG_DEFAULT;
+
+    for (int tier = 0; tier < GARDEN_LOD_TIER_COUNT; tier++) {
+        garden->lodElapsed[tier] = 0;
+    }
+
+    for (int i = 0; i < GARDEN_MAX_TILES; i++) {
+        garden->planterLodTier[i] = GARDEN_LOD_TIER_VISIBLE;
+        garden->planterLodClassified[i] = false;
+    }
+
+    garden->lodView = garden_getView(garden);
+    garden->propagationRandom = 0;
+
+    diseaseGrid_init(&garden->disease, GARDEN_COLS, GARDEN_ROWS);
+    garden->diseaseStepSeconds = GARDEN_DISEASE_STEP_SECONDS_DEFAULT;
+    garden->diseaseElapsed = 0;
+
+    temperatureField_init(
+        &garden->temperature, GARDEN_COLS, GARDEN_ROWS, GARDEN_AIR_TEMPERATURE_NIGHT);
+    garden->temperatureElapsed = 0;
+    lightIntegral_init(&garden->light, GARDEN_COLS, GARDEN_ROWS, dayOfYear);
+
+    irrigationNetwork_init(&garden->irrigation, GARDEN_COLS, GARDEN_ROWS);
+
+    weather_init(&garden->weather, GARDEN_WEATHER_SEED);
+    memset(garden->roof, 0, sizeof(garden->roof));
+    memset(garden->covered, 0, sizeof(garden->covered));
+    memset(&garden->uncoveredPlanters, 0, sizeof(garden->uncoveredPlanters));
+    garden->coverageDirty = true;
+
+    sunPath_init(&garden->sunPath);
+
+    garden->lightSourcePos = getLightSourcePosition(garden, dayOfYear, gameplayTime);
     updateLightLevelOfTiles(garden);
 }
 
@@ -223,517 +225,1115 @@ Planter *garden_getSelectedPlanter(Garden *garden) {
     return &garden->planters[planterIndex];
 }
 
-void garden_update(Garden *garden, float deltaTime, float gameplayTime) {
-    garden->lightSourcePos = getLightSourcePosition(garden, gameplayTime);
-    updateLightLevelOfTiles(garden);
+int garden_getPlantId(int planterIndex, int plantIndex) {
+    return planterIndex * PLANTER_MAX_PLANTS + plantIndex;
+}
 
-    // planters count is the same as tiles count
-    for (int planterIndex = 0; planterIndex < GARDEN_TILE_COUNT; planterIndex++) {
-        Planter *planter = &garden->planters[planterIndex];
+// The store has the state of each plant as of its `ticksCount`, which can be behind the ticks the
+// wheels say it is due: always in PLANT_SIMULATION_EVENTS, and for planters off screen (see the
+// LOD tiers). Reading a plant brings it up to date
 
-        if (!planter->exists) {
-            continue;
-        }
+/// The current state of the plant, whatever the simulation mode or LOD tier
+Plant garden_getPlantById(const Garden *garden, int plantId) {
+    Plant plant = plantStore_get(&garden->plants, plantId);
 
-        int plantsCount = planter->plantGrid.tileCount;
+    if (plant.exists) {
+        const PlantScheduler *scheduler = &garden->plantScheduler;
+        long ticks = plantScheduler_getDueTicks(scheduler, plantId, plant.ticksCount);
 
-        for (int plantIndex = 0; planterIndex < plantsCount; planterIndex++) {
-            if (planter->plants[plantIndex].exists) {
-                plant_update(&planter->plants[plantIndex], deltaTime);
-            }
+        plant_advanceTicks(&plant, ticks);
+    }
+
+    return plant;
+}
+
+Plant garden_getPlant(const Garden *garden, int planterIndex, int plantIndex) {
+    return garden_getPlantById(garden, garden_getPlantId(planterIndex, plantIndex));
+}
+
+/// Writes the plant in the store and, in PLANT_SIMULATION_EVENTS, queues its next event: the end
+/// of the segment it is in now
+static void setPlant(Garden *garden, int plantId, const Plant *plant) {
+    plantStore_set(&garden->plants, plantId, plant);
+
+    if (garden->plantSimulationMode != PLANT_SIMULATION_EVENTS) {
+        return;
+    }
+
+    PlantChanges changes = plant_getTickChanges(plant);
+    long segmentTicks = plant_getSegmentTicks(plant, &changes, PLANT_SEGMENT_MAX_TICKS);
+    long long dueAt = plantScheduler_getPopsForTicks(
+        &garden->plantScheduler, plantId, plant->ticksCount + segmentTicks);
+
+    plantEventQueue_set(&garden->plantEvents, plantId, plant->type, dueAt);
+}
+
+static bool isPlanterInMask(const GardenPlanterMask *mask, int planterIndex) {
+    return mask->bits[planterIndex / 64] >> (planterIndex % 64) & 1;
+}
+
+/// Water of the drippers under the planter, and of the rain if it is in the open. Each of its
+/// plants gets all of it
+static int getPlanterIrrigation(const Garden *garden, int planterIndex) {
+    const Planter *planter = &garden->planters[planterIndex];
+
+    if (!planter->exists) {
+        return 0;
+    }
+
+    Vector2 size = planter_getFootPrint(planter->type, planter->rotation);
+    int flow = 0;
+
+    for (int x = planter->coords.x; x < planter->coords.x + size.x; x++) {
+        for (int y = planter->coords.y; y < planter->coords.y + size.y; y++) {
+            flow += irrigationNetwork_getFlow(&garden->irrigation, x, y);
         }
     }
+
+    if (garden->weather.state == WEATHER_RAIN
+        && isPlanterInMask(&garden->uncoveredPlanters, planterIndex)) {
+        flow += WEATHER_RAIN_FLOW;
+    }
+
+    return flow;
 }
 
-Message garden_processInput(Garden *garden, InputManager *input) {
-    Vector2 *mousePos = &input->worldMousePos;
+static void addPlant(Garden *garden, int plantId, enum PlantType type, PlantGenome genome) {
+    Plant plant;
+    plant_initWithGenome(&plant, type, genome);
+    plant.irrigation = getPlanterIrrigation(garden, plantId / PLANTER_MAX_PLANTS);
+
+    plantScheduler_add(&garden->plantScheduler, plantId, type);
+    setPlant(garden, plantId, &plant);
+}
 
-    Vector2 tileHoveredCoords = grid_worldPointToCoords(
-        &SCENE_TRANSFORM, mousePos->x, mousePos->y, TILE_WIDTH, TILE_HEIGHT);
+/// Adds a wild type plant
+void garden_addPlant(Garden *garden, int planterIndex, int plantIndex, enum PlantType type) {
+    int plantId = garden_getPlantId(planterIndex, plantIndex);
 
-    int tileHoveredIndex = grid_getTileIndexFromCoords(
-        GARDEN_COLS, GARDEN_ROWS, tileHoveredCoords.x, tileHoveredCoords.y);
+    if (garden->plants.exists[plantId]) {
+        return;
+    }
 
-    garden->tileHovered = tileHoveredIndex;
+    addPlant(garden, plantId, type, 0);
+}
 
-    garden->planterTileHovered = -1;
+/// Adds a plant grown from a cutting of the plants of the same species in the planter: a cross of
+/// the first two (or a copy of the only one) with some mutations. With none, a wild type plant
+void garden_propagatePlant(Garden *garden, int planterIndex, int plantIndex, enum PlantType type) {
+    int plantId = garden_getPlantId(planterIndex, plantIndex);
+    const PlantStore *plants = &garden->plants;
 
-    if (garden->tileHovered != -1 && garden->tiles[garden->tileHovered].planterIndex != -1) {
-        int planterIndex = garden->tiles[garden->tileHovered].planterIndex;
+    if (plants->exists[plantId]) {
+        return;
+    }
 
-        if (planterIndex != -1) {
-            Planter *planter = &garden->planters[planterIndex];
+    int parents[2];
+    int parentsCount = 0;
 
-            if (planter->exists) {
-                Vector2 planterOrigin = grid_getTileOrigin(
-                    &SCENE_TRANSFORM, planter->coords, TILE_WIDTH, TILE_HEIGHT);
+    for (int i = 0; i < PLANTER_MAX_PLANTS && parentsCount < 2; i++) {
+        int parentId = garden_getPlantId(planterIndex, i);
 
-                garden->planterTileHovered = planter_getPlantIndexFromWorldPos(
-                    planter, planterOrigin, input->worldMousePos);
-            }
+        if (plants->exists[parentId] && plants->type[parentId] == type) {
+            parents[parentsCount++] = parentId;
         }
     }
 
-    if (tileHoveredIndex != -1
-        && input->mouseButtonState[MOUSE_BUTTON_LEFT] == MOUSE_BUTTON_STATE_PRESSED) {
+    PlantGenome genome = 0;
+
+    if (parentsCount > 0) {
+        PlantGenome a = plants->genome[parents[0]];
+        PlantGenome b = plants->genome[parents[parentsCount - 1]];
 
-        return (Message){MESSAGE_EV_TILE_CLICKED, {.selection = tileHoveredIndex}};
+        genome = plantGenome_cross(a, b, utils_random(&garden->propagationRandom));
+        genome = plantGenome_mutate(genome, utils_random(&garden->propagationRandom));
     }
 
-    return (Message){MESSAGE_NONE};
+    addPlant(garden, plantId, type, genome);
 }
 
-void drawIsoRectangleLines(Garden *garden, IsoRec isoRec, int lineWidth, Color color) {
-    DrawLineEx(isoRec.top, isoRec.left, 2, color);
-    DrawLineEx(isoRec.left, isoRec.bottom, 2, color);
-    DrawLineEx(isoRec.bottom, isoRec.right, 2, color);
-    DrawLineEx(isoRec.right, isoRec.top, 2, color);
+void garden_removePlant(Garden *garden, int planterIndex, int plantIndex) {
+    int plantId = garden_getPlantId(planterIndex, plantIndex);
+
+    plantStore_remove(&garden->plants, plantId);
+
+    plantScheduler_remove(&garden->plantScheduler, plantId);
+    plantEventQueue_remove(&garden->plantEvents, plantId);
 }
 
-typedef enum {
-    DRAWABLE_PLANTER,
-    DRAWABLE_PLANT,
-} DrawableType;
+void garden_irrigatePlant(Garden *garden, int planterIndex, int plantIndex) {
+    int plantId = garden_getPlantId(planterIndex, plantIndex);
+    Plant plant = garden_getPlantById(garden, plantId);
+
+    if (plant.exists) {
+        plant_irrigate(&plant);
+        setPlant(garden, plantId, &plant);
+    }
+}
+
+void garden_feedPlant(Garden *garden, int planterIndex, int plantIndex) {
+    int plantId = garden_getPlantId(planterIndex, plantIndex);
+    Plant plant = garden_getPlantById(garden, plantId);
+
+    if (plant.exists) {
+        plant_feed(&plant);
+        setPlant(garden, plantId, &plant);
+    }
+}
 
 typedef struct {
-    DrawableType type;
-    void *data;
-    Vector2 origin;
-    int tileDepth;
-    int localDepth;
-    bool highlight;
-    bool pickedUp;
-} Drawable;
+    PlantStoreIndex index;
+    int minLevel;
+    int maxLevel;
+} GardenNeedLevels;
+
+/// Levels of the needs the level index can tell, the same for every plant. Not of
+/// GARDEN_NEED_NUTRIENTS: the optimal nutrition is of each plant, see PlantStore.underfed
+static GardenNeedLevels getNeedLevels(GardenNeed need) {
+    assert(need != GARDEN_NEED_NUTRIENTS);
+
+    switch (need) {
+    case GARDEN_NEED_WATER:
+        return (GardenNeedLevels){PLANT_STORE_INDEX_HYDRATION, 0, PLANT_WATER_LEVEL_MOIST - 1};
+    case GARDEN_NEED_NUTRIENTS:
+    case GARDEN_NEED_HEALTH:
+    case GARDEN_NEED_COUNT:
+        break;
+    }
 
-int compareDrawableDepths(const void *a, const void *b) {
-    const Drawable *da = a;
-    const Drawable *db = b;
+    return (GardenNeedLevels){
+        PLANT_STORE_INDEX_HEALTH, PLANT_HEALTH_LEVEL_DYING, PLANT_HEALTH_LEVEL_DYING};
+}
 
-    // TODO: != ???? no deberia ser > ???
-    if (da->tileDepth != db->tileDepth) {
-        return da->tileDepth - db->tileDepth;
+/// Plants short of `need`, as of the store
+int garden_countPlantsInNeed(const Garden *garden, GardenNeed need) {
+    if (need == GARDEN_NEED_NUTRIENTS) {
+        return plantStore_countUnderfed(&garden->plants);
     }
 
-    return da->localDepth - db->localDepth;
+    GardenNeedLevels levels = getNeedLevels(need);
+
+    return plantStore_countInLevels(
+        &garden->plants, levels.index, levels.minLevel, levels.maxLevel);
 }
 
-int getPlantZIndex(Rotation gardenRotation, Planter *planter, int plantIndex) {
-    Vector2 plantCoords = grid_getCoordsFromTileIndex(planter->plantGrid.cols, plantIndex);
+/// Next plant id after `afterPlantId` (-1 for the first one) short of `need`, as of the store, or
+/// -1 if none is
+int garden_findNextPlantInNeed(const Garden *garden, GardenNeed need, int afterPlantId) {
+    if (need == GARDEN_NEED_NUTRIENTS) {
+        return plantStore_findUnderfed(&garden->plants, afterPlantId);
+    }
 
-    int zIndex = grid_getZIndex(gardenRotation,
-        plantCoords.x,
-        plantCoords.y,
-        planter->plantGrid.cols,
-        planter->plantGrid.rows);
+    GardenNeedLevels levels = getNeedLevels(need);
 
-    return zIndex;
+    return plantStore_findInLevels(
+        &garden->plants, levels.index, levels.minLevel, levels.maxLevel, afterPlantId);
 }
 
-int getPlanterZIndex(Garden *garden, int planterTileIndex) {
-    IsoRec planterIsoRec = getPlanterIsoVertices(garden, planterTileIndex);
-    Vector2 nearestTileCoords = grid_worldPointToCoords(&SCENE_TRANSFORM,
-        planterIsoRec.right.x - 1,
-        planterIsoRec.right.y,
-        TILE_WIDTH,
-        TILE_HEIGHT);
+void garden_prunePlant(Garden *garden, int planterIndex, int plantIndex) {
+    int plantId = garden_getPlantId(planterIndex, plantIndex);
+    Plant plant = garden_getPlantById(garden, plantId);
 
-    int zIndex = grid_getZIndex(SCENE_TRANSFORM.rotation,
-        nearestTileCoords.x,
-        nearestTileCoords.y,
-        GARDEN_COLS,
-        GARDEN_ROWS);
+    if (plant.exists) {
+        plant_prune(&plant);
+        setPlant(garden, plantId, &plant);
+    }
+}
+
+/// Switches between ticking every plant and updating them on their events, keeping the state of
+/// the plants
+void garden_setPlantSimulationMode(Garden *garden, PlantSimulationMode mode) {
+    if (garden->plantSimulationMode == mode) {
+        return;
+    }
+
+    plantEventQueue_clear(&garden->plantEvents);
+    garden->plantSimulationMode = mode;
 
-    return zIndex;
+    // the ticks mode expects the plants it ticks to be up to date, the events one to have an event
+    for (int plantId = 0; plantId < GARDEN_MAX_PLANTS; plantId++) {
+        if (garden->plants.exists[plantId]) {
+            Plant plant = garden_getPlantById(garden, plantId);
+            setPlant(garden, plantId, &plant);
+        }
+    }
 }
 
-void garden_draw(Garden *garden, enum GardeningTool toolSelected, int toolVariantSelected) {
-    assert(TILE_WIDTH > 0);
-    assert(TILE_HEIGHT > 0);
-    IsoRec hoveredTile = {{0, 0}, {0, 0}, {0, 0}, {0, 0}};
-    IsoRec selectedTile = {{0, 0}, {0, 0}, {0, 0}, {0, 0}};
+/// Removes the planter and its plants. Tiles used by the planter are not updated
+void garden_removePlanter(Garden *garden, int planterIndex) {
+    Planter *planter = &garden->planters[planterIndex];
 
-    int maxEntities = GARDEN_TILE_COUNT + (GARDEN_TILE_COUNT * PLANTER_MAX_PLANTS);
+    for (int plantIndex = 0; plantIndex < planter->plantGrid.tileCount; plantIndex++) {
+        garden_removePlant(garden, planterIndex, plantIndex);
+    }
 
-    Drawable entitiesToDraw[maxEntities];
-    int entitiesToDrawCount = 0;
+    planter->exists = false;
+    rehashPlanter(garden, planterIndex);
+}
 
-    // Draw tiles and identify the hovered and selected tile
-    for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
-        IsoRec currentTile = getTileIsoVertices(garden, i);
-
-        DrawTexturePro(slab1Texture,
-            (Rectangle){0, 0, slab1Texture.width, slab1Texture.height},
-            (Rectangle){
-                currentTile.left.x,
-                currentTile.top.y,
-                TILE_WIDTH * SCENE_TRANSFORM.scale,
-                TILE_HEIGHT * SCENE_TRANSFORM.scale,
-            },
-            (Vector2){0, 0},
-            0,
-            WHITE);
-
-        if (garden->tileSelected == i || garden->tileHovered == i) {
-            int planterIndex = garden->tiles[i].planterIndex;
-
-            if (garden->tileHovered == i) {
-                currentTile = getHoveredIsoVertices(garden, i, toolSelected, toolVariantSelected);
-            } else if (planterIndex != -1 && garden->planters[planterIndex].exists) {
-                currentTile = getPlanterIsoVertices(garden, i);
+void garden_addPlanterToMask(GardenPlanterMask *mask, int planterIndex) {
+    mask->bits[planterIndex / 64] |= (uint64_t)1 << (planterIndex % 64);
+}
+
+/// Adds to `mask` the planters with any tile in `area`, found through the tiles
+void garden_getPlantersInArea(const Garden *garden, GardenArea area, GardenPlanterMask *mask) {
+    for (int y = area.y - area.radius; y <= area.y + area.radius; y++) {
+        for (int x = area.x - area.radius; x <= area.x + area.radius; x++) {
+            if (!grid_isValidCoords(GARDEN_COLS, GARDEN_ROWS, x, y)) {
+                continue;
+            }
+
+            int dx = x - area.x;
+            int dy = y - area.y;
+
+            if (area.round && dx * dx + dy * dy > area.radius * area.radius) {
+                continue;
+            }
+
+            int tileIndex = grid_getTileIndexFromCoords(GARDEN_COLS, GARDEN_ROWS, x, y);
+            int planterIndex = garden->tiles[tileIndex].planterIndex;
+
+            if (planterIndex != -1) {
+                garden_addPlanterToMask(mask, planterIndex);
             }
+        }
+    }
+}
+
+/// Waters or feeds every plant of the planters in `planters`, in one pass over them
+void garden_careForPlanters(Garden *garden, GardenCare care, const GardenPlanterMask *planters) {
+    for (int wordIndex = 0; wordIndex < GARDEN_PLANTER_MASK_WORDS; wordIndex++) {
+        uint64_t word = planters->bits[wordIndex];
+
+        while (word != 0) {
+            int planterIndex = wordIndex * 64 + __builtin_ctzll(word);
+            const Planter *planter = &garden->planters[planterIndex];
+
+            word &= word - 1;
 
-            if (garden->tileSelected == i) {
-                selectedTile = currentTile;
+            if (!planter->exists) {
+                continue;
             }
 
-            if (garden->tileHovered == i) {
-                hoveredTile = currentTile;
+            for (int plantIndex = 0; plantIndex < planter->plantGrid.tileCount; plantIndex++) {
+                if (care == GARDEN_CARE_IRRIGATE) {
+                    garden_irrigatePlant(garden, planterIndex, plantIndex);
+                } else {
+                    garden_feedPlant(garden, planterIndex, plantIndex);
+                }
             }
         }
     }
+}
+
+/// Lays `piece` on the tile at (`x`, `y`), or takes the one there away with
+/// IRRIGATION_PIECE_NONE. The flows are solved with the next update
+void garden_setIrrigationPiece(Garden *garden, int x, int y, IrrigationPiece piece) {
+    irrigationNetwork_setPiece(&garden->irrigation, x, y, piece);
+}
 
-    // Draw garden outline
-    drawIsoRectangleLines(garden, getGardenIsoVertices(garden), 4, WHITE);
+/// Puts up the roof over the tile at (`x`, `y`), or takes it down. Out of the garden does nothing
+void garden_setRoof(Garden *garden, int x, int y, bool roofed) {
+    int tileIndex = grid_getTileIndexFromCoords(GARDEN_COLS, GARDEN_ROWS, x, y);
 
-    // Draw selection/hovered indicators
-    if (!(selectedTile.left.x == 0 && selectedTile.right.x == 0)) {
-        drawIsoRectangleLines(garden, selectedTile, 2, DARKBROWN);
+    if (tileIndex == -1) {
+        return;
     }
 
-    if (!(hoveredTile.left.x == 0 && hoveredTile.right.x == 0)) {
-        BeginBlendMode(BLEND_ADDITIVE);
+    uint64_t bit = (uint64_t)1 << (tileIndex % 64);
 
-        DrawTriangle(
-            hoveredTile.left, hoveredTile.bottom, hoveredTile.right, (Color){255, 255, 255, 40});
-        DrawTriangle(
-            hoveredTile.right, hoveredTile.top, hoveredTile.left, (Color){255, 255, 255, 40});
-        EndBlendMode();
+    if (roofed) {
+        garden->roof[tileIndex / 64] |= bit;
+    } else {
+        garden->roof[tileIndex / 64] &= ~bit;
     }
 
-    GardenTile *tileHovered = &garden->tiles[garden->tileHovered];
+    garden->coverageDirty = true;
+}
 
-    // Get all the entities to draw
-    for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
+void garden_runCommand(Garden *garden, const GardenCommand *command) {
+    const GardenCommandArgs *args = &command->args;
+
+    switch (command->type) {
+    case GARDEN_COMMAND_ADD_PLANT:
+        garden_addPlant(garden, args->plant.planterIndex, args->plant.plantIndex, args->plant.type);
+        break;
+
+    case GARDEN_COMMAND_PROPAGATE_PLANT:
+        garden_propagatePlant(
+            garden, args->plant.planterIndex, args->plant.plantIndex, args->plant.type);
+        break;
+
+    case GARDEN_COMMAND_REMOVE_PLANT:
+        garden_removePlant(garden, args->plant.planterIndex, args->plant.plantIndex);
+        break;
+
+    case GARDEN_COMMAND_IRRIGATE_PLANT:
+        garden_irrigatePlant(garden, args->plant.planterIndex, args->plant.plantIndex);
+        break;
+
+    case GARDEN_COMMAND_FEED_PLANT:
+        garden_feedPlant(garden, args->plant.planterIndex, args->plant.plantIndex);
+        break;
+
+    case GARDEN_COMMAND_PRUNE_PLANT:
+        garden_prunePlant(garden, args->plant.planterIndex, args->plant.plantIndex);
+        break;
+
+    case GARDEN_COMMAND_SET_PLANTER:
+        garden->planters[args->planter.planterIndex] = args->planter.planter;
+        rehashPlanter(garden, args->planter.planterIndex);
+        // the drippers under it are others, and it can be covered or cover others
+        garden->irrigation.dirty = true;
+        garden->coverageDirty = true;
+        break;
+
+    case GARDEN_COMMAND_REMOVE_PLANTER:
+        garden_removePlanter(garden, args->planter.planterIndex);
+        garden->irrigation.dirty = true;
+        garden->coverageDirty = true;
+        break;
+
+    case GARDEN_COMMAND_CARE_FOR_PLANTERS:
+        garden_careForPlanters(garden, args->care.care, &args->care.planters);
+        break;
+
+    case GARDEN_COMMAND_SET_IRRIGATION_PIECE:
+        garden_setIrrigationPiece(
+            garden, args->irrigation.x, args->irrigation.y, args->irrigation.piece);
+        break;
+
+    case GARDEN_COMMAND_SET_ROOF:
+        garden_setRoof(garden, args->roof.x, args->roof.y, args->roof.roofed);
+        break;
+    }
+}
 
-        Planter *planter = &garden->planters[i];
-
-        if (planter->exists) {
-            int isoTileIndex = grid_getTileIndexFromCoords(
-                GARDEN_COLS, GARDEN_ROWS, planter->coords.x, planter->coords.y);
-
-            Vector2 planterDrawPos = getPlanterDrawPos(garden, planter->coords);
-
-            int zIndex = getPlanterZIndex(garden, isoTileIndex);
-            bool pickedUp = i == garden->planterPickedUpIndex;
-            bool planterHighlight
-                = i == tileHovered->planterIndex && i != garden->planterPickedUpIndex;
-
-            entitiesToDraw[entitiesToDrawCount] = (Drawable){
-                .type = DRAWABLE_PLANTER,
-                .data = planter,
-                .origin = planterDrawPos,
-                .tileDepth = zIndex,
-                .highlight = planterHighlight,
-                .pickedUp = pickedUp,
-            };
-
-            entitiesToDrawCount++;
-
-            int plantsCount = planter->plantGrid.tileCount;
-            for (int j = 0; j < plantsCount; j++) {
-                if (planter->plants[j].exists) {
-                    Vector2 plantOrigin = planter_getPlantDrawOrigin(planter, j);
-
-                    entitiesToDraw[entitiesToDrawCount] = (Drawable){
-                        .type = DRAWABLE_PLANT,
-                        .data = &planter->plants[j],
-                        .origin = plantOrigin,
-                        .tileDepth = zIndex,
-                        .localDepth = getPlantZIndex(SCENE_TRANSFORM.rotation, planter, j),
-                        .highlight = planterHighlight && i == tileHovered->planterIndex
-                                  && j == garden->planterTileHovered,
-                        .pickedUp = pickedUp,
-                    };
-
-                    entitiesToDrawCount++;
-                }
-            }
-        }
+// Sim LOD: planters are put in a tier each frame by how far they are from the view. VISIBLE ones
+// (and the selected one) are updated every frame. The others are skipped, falling behind, and
+// their tier brings them up to date once per period with all the time they missed, which
+// plant_advanceTicks simulates exactly. The lag of a tier is the accuracy bound: the most its
+// plants can be behind in the store (i.e. for aggregates), reading one always gives its exact state
+
+/// Seconds between the updates of a tier
+static double getLodPeriod(const Garden *garden, GardenLodTier tier) {
+    switch (tier) {
+    case GARDEN_LOD_TIER_VISIBLE:
+        return 0;
+    case GARDEN_LOD_TIER_NEAR:
+        return garden->lodMaxLag / 4;
+    default:
+        return garden->lodMaxLag;
+    }
+}
+
+static GardenLodTier getPlanterLodTier(
+    const Garden *garden, const GardenView *view, int planterIndex) {
+    if (planterIndex == view->planterSelected) {
+        return GARDEN_LOD_TIER_VISIBLE;
     }
 
-    // Draw entities
-    qsort(entitiesToDraw, entitiesToDrawCount, sizeof(Drawable), compareDrawableDepths);
+    const Planter *p = &garden->planters[planterIndex];
+    IsoRec isoRec = grid_toIsoRec(&view->transform,
+        p->coords,
+        planter_getFootPrint(p->type, p->rotation),
+        TILE_WIDTH,
+        TILE_HEIGHT);
 
-    for (int i = 0; i < entitiesToDrawCount; i++) {
-        Vector2 origin = entitiesToDraw[i].origin;
-        Color color = entitiesToDraw[i].pickedUp ? (Color){255, 255, 255, 100} : WHITE;
+    // bounds of the planter, with room for the tallest plant sprite above it
+    // (the view can be rotated, so any vertex can be the top one)
+    Vector2 vertices[] = {isoRec.left, isoRec.top, isoRec.right, isoRec.bottom};
+    Vector2 min = vertices[0];
+    Vector2 max = vertices[0];
 
-        if (entitiesToDraw[i].type == DRAWABLE_PLANTER) {
-            Planter *p = entitiesToDraw[i].data;
+    for (int i = 1; i < 4; i++) {
+        min = (Vector2){fminf(min.x, vertices[i].x), fminf(min.y, vertices[i].y)};
+        max = (Vector2){fmaxf(max.x, vertices[i].x), fmaxf(max.y, vertices[i].y)};
+    }
 
-            planter_draw(p, origin, SCENE_TRANSFORM.scale, SCENE_TRANSFORM.rotation, color);
+    min.y -= PLANT_SPRITE_HEIGHT * view->transform.scale;
 
-            if (entitiesToDraw[i].highlight) {
-                BeginBlendMode(BLEND_ADDITIVE);
-                planter_draw(p,
-                    origin,
-                    SCENE_TRANSFORM.scale,
-                    SCENE_TRANSFORM.rotation,
-                    (Color){255, 255, 255, 100});
-                EndBlendMode();
-            }
-        } else {
-            Plant *p = entitiesToDraw[i].data;
+    Rectangle bounds = {min.x, min.y, max.x - min.x, max.y - min.y};
+
+    Rectangle screen = {0, 0, garden->viewSize.x, garden->viewSize.y};
+
+    if (utils_recsOverlap(bounds, screen)) {
+        return GARDEN_LOD_TIER_VISIBLE;
+    }
+
+    // less than a view away
+    Rectangle nearView = {-screen.width, -screen.height, screen.width * 3, screen.height * 3};
+
+    if (utils_recsOverlap(bounds, nearView)) {
+        return GARDEN_LOD_TIER_NEAR;
+    }
+
+    return GARDEN_LOD_TIER_FAR;
+}
+
+static bool isPlantLagging(const Garden *garden, int plantId) {
+    return garden->planterLodTier[plantId / PLANTER_MAX_PLANTS] != GARDEN_LOD_TIER_VISIBLE;
+}
+
+/// Brings the plant up to date in the store
+static void syncPlant(Garden *garden, int plantId) {
+    Plant plant = garden_getPlantById(garden, plantId);
+    setPlant(garden, plantId, &plant);
+}
+
+/// Puts each planter in its tier, resyncing the ones that come into view. The tier of a planter
+/// only changes when the view or the selection do, or when it is new
+static void updateLodTiers(Garden *garden, const GardenView *view) {
+    bool viewChanged = memcmp(&garden->lodView, view, sizeof(GardenView)) != 0;
 
-            plant_draw(p, origin, SCENE_TRANSFORM.scale, color);
+    garden->lodView = *view;
 
-            if (entitiesToDraw[i].highlight) {
-                BeginBlendMode(BLEND_ADDITIVE);
-                plant_draw(p, origin, SCENE_TRANSFORM.scale, (Color){255, 255, 255, 100});
-                EndBlendMode();
+    for (int planterIndex = 0; planterIndex < GARDEN_MAX_TILES; planterIndex++) {
+        const Planter *planter = &garden->planters[planterIndex];
+
+        if (!planter->exists) {
+            garden->planterLodTier[planterIndex] = GARDEN_LOD_TIER_VISIBLE;
+            garden->planterLodClassified[planterIndex] = false;
+            continue;
+        }
+
+        if (!viewChanged && garden->planterLodClassified[planterIndex]) {
+            continue;
+        }
+
+        garden->planterLodClassified[planterIndex] = true;
+
+        GardenLodTier tier = getPlanterLodTier(garden, view, planterIndex);
+        bool comesIntoView = tier == GARDEN_LOD_TIER_VISIBLE
+                          && garden->planterLodTier[planterIndex] != GARDEN_LOD_TIER_VISIBLE;
+
+        garden->planterLodTier[planterIndex] = tier;
+
+        if (!comesIntoView) {
+            continue;
+        }
+
+        for (int plantIndex = 0; plantIndex < planter->plantGrid.tileCount; plantIndex++) {
+            int plantId = garden_getPlantId(planterIndex, plantIndex);
+
+            if (garden->plants.exists[plantId]) {
+                syncPlant(garden, plantId);
             }
         }
     }
+}
 
-    // Draw available slots to put a plant when a plant cutting is selected
-    if (toolSelected == GARDENING_TOOL_PLANT_CUTTING) {
-        for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
-            if (!garden->planters[i].exists) {
-                continue;
-            }
+/// Finds the tiers that have to be brought up to date this frame
+static void updateLodTimers(Garden *garden, double deltaTime, bool tierDue[GARDEN_LOD_TIER_COUNT]) {
+    for (int tier = 0; tier < GARDEN_LOD_TIER_COUNT; tier++) {
+        garden->lodElapsed[tier] += deltaTime;
+        tierDue[tier] = garden->lodElapsed[tier] >= getLodPeriod(garden, tier);
+
+        if (tierDue[tier]) {
+            garden->lodElapsed[tier] = 0;
+        }
+    }
+}
 
-            Planter *planter = &garden->planters[i];
+/// Appends the plants of the planters of the lagging tiers in `tierDue` to `plantIds`. In
+/// PLANT_SIMULATION_EVENTS only the ones without an event, which were deferred
+static int collectLaggingPlants(
+    const Garden *garden, const bool tierDue[GARDEN_LOD_TIER_COUNT], int *plantIds) {
+    int count = 0;
+    bool anyDue = false;
 
-            for (int j = 0; j < planter->plantGrid.tileCount; j++) {
-                // don't draw slot indicator if the planter has a plant in that slot
-                if (planter->plants[j].exists
-                    || (i == garden->tiles[garden->tileHovered].planterIndex
-                        && j == garden->planterTileHovered)) {
-                    continue;
-                }
+    for (int tier = GARDEN_LOD_TIER_VISIBLE + 1; tier < GARDEN_LOD_TIER_COUNT; tier++) {
+        anyDue = anyDue || tierDue[tier];
+    }
 
-                Vector2 plantWorldPos = planter_getPlantDrawOrigin(planter, j);
+    if (!anyDue) {
+        return 0;
+    }
 
-                DrawEllipse(plantWorldPos.x, plantWorldPos.y, 10, 5, (Color){255, 255, 255, 225});
-            }
+    for (int plantId = 0; plantId < GARDEN_MAX_PLANTS; plantId++) {
+        GardenLodTier tier = garden->planterLodTier[plantId / PLANTER_MAX_PLANTS];
+
+        if (tier == GARDEN_LOD_TIER_VISIBLE || !tierDue[tier] || !garden->plants.exists[plantId]) {
+            continue;
         }
+
+        if (garden->plantSimulationMode == PLANT_SIMULATION_EVENTS
+            && garden->plantEvents.indexOf[plantId] != -1) {
+            continue;
+        }
+
+        plantIds[count++] = plantId;
     }
 
-    // Draw item on hovered tile
-    if (garden->tileHovered != -1) {
-        int hoveredIndex = garden->tileHovered;
+    return count;
+}
+
+/// plants ticked by a job
+#define GARDEN_UPDATE_BATCH_SIZE 256
+
+typedef struct {
+    PlantStore *store;
+    enum PlantType type;
+    const int *plantIds;
+    /// ticks each plant is due. 0 for a regular update, where every plant is due 1 tick
+    long ticks;
+} TickBatch;
+
+static void tickPlantsJob(void *context, int first, int count) {
+    TickBatch *batch = context;
+
+    if (batch->ticks == 0) {
+        plantStore_tick(batch->store, batch->type, &batch->plantIds[first], count);
+    } else {
+        plantStore_advanceTicks(batch->store, &batch->plantIds[first], count, batch->ticks);
+    }
+}
+
+typedef struct {
+    Garden *garden;
+    const int *plantIds;
+} SyncBatch;
+
+/// Only for PLANT_SIMULATION_TICKS, where syncing a plant doesn't touch the event queue
+static void syncPlantsJob(void *context, int first, int count) {
+    SyncBatch *batch = context;
 
-        switch (toolSelected) {
-        case GARDENING_TOOL_NONE:
-            if (garden->planterPickedUpIndex != -1) {
-                Planter *originalPlanter = &garden->planters[garden->planterPickedUpIndex];
+    for (int i = first; i < first + count; i++) {
+        syncPlant(batch->garden, batch->plantIds[i]);
+    }
+}
 
-                Vector2 drawOrigin = (Vector2){hoveredTile.left.x, hoveredTile.top.y};
-                Planter p = *originalPlanter;
-                Vector2 gridCoords = grid_getCoordsFromTileIndex(GARDEN_COLS, hoveredIndex);
+/// Appends the plants of `slot` to `plantIds`, but the lagging ones, and returns how many there are
+static int collectSlotPlants(const Garden *garden, enum PlantType type, int slot, int *plantIds) {
+    const PlantScheduler *scheduler = &garden->plantScheduler;
+    int count = 0;
 
-                Color color = {255, 255, 255, 200};
+    for (int plantId = scheduler->slotHead[type][slot]; plantId != -1;
+        plantId = scheduler->next[plantId]) {
+        if (!isPlantLagging(garden, plantId)) {
+            plantIds[count++] = plantId;
+        }
+    }
 
-                planter_init(
-                    &p, originalPlanter->type, gridCoords, garden->selectionRotation, TILE_WIDTH);
+    return count;
+}
 
-                planter_draw(
-                    &p, drawOrigin, SCENE_TRANSFORM.scale, SCENE_TRANSFORM.rotation, color);
+/// Moves the wheels without ticking anything, and updates only the plants whose segment ended.
+/// A plant can be more than a segment behind (a long frame), plant_advanceTicks takes care of it.
+/// Events of lagging plants are dropped until their tier is due
+static void processPlantEvents(Garden *garden, const bool tierDue[GARDEN_LOD_TIER_COUNT]) {
+    PlantScheduler *scheduler = &garden->plantScheduler;
+    PlantEventQueue *events = &garden->plantEvents;
 
-                for (int i = 0; i < p.plantGrid.tileCount; i++) {
-                    Plant *plant = &originalPlanter->plants[i];
+    for (int type = 0; type < PLANT_TYPE_COUNT; type++) {
+        long ticksBySlot[PLANT_SCHEDULER_SLOTS];
+        plantScheduler_skipDueSlots(scheduler, type, ticksBySlot);
 
-                    if (plant->exists) {
-                        Vector2 plantOrigin = planter_getPlantDrawOrigin(&p, i);
+        int plantId;
 
-                        plant_draw(plant, plantOrigin, SCENE_TRANSFORM.scale, color);
-                    }
-                }
+        while ((plantId = plantEventQueue_peek(events, type)) != -1
+               && events->dueAt[plantId] <= scheduler->slotsPopped[type]) {
+            GardenLodTier tier = garden->planterLodTier[plantId / PLANTER_MAX_PLANTS];
+
+            if (tierDue[tier]) {
+                syncPlant(garden, plantId);
+            } else {
+                plantEventQueue_remove(events, plantId);
             }
+        }
+    }
 
-            break;
-        case GARDENING_TOOL_PLANTER: {
-            Vector2 drawOrigin = (Vector2){hoveredTile.left.x, hoveredTile.top.y};
-            Planter p;
-            Vector2 gridCoords = grid_getCoordsFromTileIndex(GARDEN_COLS, hoveredIndex);
+    int deferredIds[GARDEN_MAX_PLANTS];
+    int deferredCount = collectLaggingPlants(garden, tierDue, deferredIds);
 
-            planter_init(
-                &p, toolVariantSelected, gridCoords, garden->selectionRotation, TILE_WIDTH);
+    for (int i = 0; i < deferredCount; i++) {
+        syncPlant(garden, deferredIds[i]);
+    }
+}
 
-            planter_draw(&p,
-                drawOrigin,
-                SCENE_TRANSFORM.scale,
-                SCENE_TRANSFORM.rotation,
-                (Color){255, 255, 255, 200});
-        } break;
+/// Ticks the plants for `deltaTime` more seconds. A wheel that is less than a turn behind pops its
+/// due slots and their plants get a tick each. One that is a turn behind or more (a long frame,
+/// fast speeds, catching up) is brought up to date at once, and the plants of each slot jump all
+/// their due ticks with plant_advanceTicks. Either way a plant is in one job at most.
+/// Plants only read their own state, so the batches are split in jobs for the job pool.
+/// In PLANT_SIMULATION_EVENTS only the plants with a due event are updated instead
+static void updatePlants(
+    Garden *garden, double deltaTime, const bool tierDue[GARDEN_LOD_TIER_COUNT]) {
+    PlantScheduler *scheduler = &garden->plantScheduler;
+
+    plantScheduler_advance(scheduler, deltaTime);
+
+    if (garden->plantSimulationMode == PLANT_SIMULATION_EVENTS) {
+        processPlantEvents(garden, tierDue);
+        return;
+    }
 
-        case GARDENING_TOOL_PLANT_CUTTING: {
-            int planterIndex = garden->tiles[hoveredIndex].planterIndex;
-            Planter *planter = &garden->planters[planterIndex];
+    int dueIds[GARDEN_MAX_PLANTS];
+    int dueCount = 0;
+    TickBatch batches[PLANT_TYPE_COUNT * PLANT_SCHEDULER_SLOTS];
+    int batchesCount = 0;
 
-            Vector2 drawOrigin;
+    for (int type = 0; type < PLANT_TYPE_COUNT; type++) {
+        if (plantScheduler_isTurnBehind(scheduler, type)) {
+            long ticksBySlot[PLANT_SCHEDULER_SLOTS];
+            plantScheduler_skipDueSlots(scheduler, type, ticksBySlot);
 
-            if (planterIndex != -1 && planter->exists && planter->plantGrid.tileCount > 0) {
-                drawOrigin = planter_getPlantDrawOrigin(planter, garden->planterTileHovered);
+            for (int slot = 0; slot < PLANT_SCHEDULER_SLOTS; slot++) {
+                TickBatch *batch = &batches[batchesCount++];
+                *batch = (TickBatch){&garden->plants, type, &dueIds[dueCount], ticksBySlot[slot]};
 
-            } else {
-                float plantBasePosY = TILE_HEIGHT * SCENE_TRANSFORM.scale / 2.0f;
+                int count = collectSlotPlants(garden, type, slot, &dueIds[dueCount]);
+                dueCount += count;
 
-                drawOrigin = (Vector2){
-                    hoveredTile.bottom.x,
-                    hoveredTile.bottom.y - plantBasePosY,
-                };
+                jobPool_submitRange(tickPlantsJob, batch, count, GARDEN_UPDATE_BATCH_SIZE);
             }
 
-            Plant plant = {.health = 100};
-            plant_init(&plant, toolVariantSelected);
-            plant_draw(&plant, drawOrigin, SCENE_TRANSFORM.scale, (Color){255, 255, 255, 200});
-        } break;
+            continue;
+        }
 
-        case GARDENING_TOOL_COUNT:
-            assert(false);
+        // only the plants in the slots the wheel passed over are touched, a species at a time so
+        // the whole batch shares the same definition
+        TickBatch *batch = &batches[batchesCount++];
+        *batch = (TickBatch){&garden->plants, type, &dueIds[dueCount], 0};
+        int batchStart = dueCount;
+        int slot;
 
-        default:
-            break;
+        while ((slot = plantScheduler_popDueSlot(scheduler, type)) != -1) {
+            dueCount += collectSlotPlants(garden, type, slot, &dueIds[dueCount]);
         }
+
+        jobPool_submitRange(
+            tickPlantsJob, batch, dueCount - batchStart, GARDEN_UPDATE_BATCH_SIZE);
     }
 
-    // drawings for debug - maybe refactor into something to control this on runtime?
+    // lagging plants are never in the batches above
+    int laggingIds[GARDEN_MAX_PLANTS];
+    SyncBatch syncBatch = {garden, laggingIds};
+    int laggingCount = collectLaggingPlants(garden, tierDue, laggingIds);
+
+    jobPool_submitRange(syncPlantsJob, &syncBatch, laggingCount, GARDEN_UPDATE_BATCH_SIZE);
+
+    // join before anything else (i.e. garden_draw) reads the plants
+    jobPool_wait();
+}
+
+/// The view and selection of the scene, for the sim LOD
+GardenView garden_getView(const Garden *garden) {
+    GardenView view = {.transform = SCENE_TRANSFORM, .planterSelected = -1};
 
-    bool showZIndexOnTile = false;
-    bool showZIndexOnEntity = false;
-    bool showPlanterIndexOnTile = false;
-    bool showPlantIndexOnPlanter = true;
-    bool drawTileBounds = false;
-    bool drawPlantBounds = false;
-    char buffer[16];
+    if (garden->tileSelected != -1) {
+        view.planterSelected = garden->tiles[garden->tileSelected].planterIndex;
+    }
 
-    if (drawPlantBounds) {
-        for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
-            Planter *planter = &garden->planters[i];
+    return view;
+}
 
-            if (planter->exists) {
-                for (int j = 0; j < planter->plantGrid.tileCount; j++) {
-                    if (planter->plants[j].exists) {
+/// Moves the light with the time of the day. Depends on the view, so it belongs to the thread
+/// that draws
+void garden_updateLight(Garden *garden, int dayOfYear, float gameplayTime) {
+    garden->lightSourcePos = getLightSourcePosition(garden, dayOfYear, gameplayTime);
+    updateLightLevelOfTiles(garden);
+}
 
-                        Vector2 plantCoords
-                            = grid_getCoordsFromTileIndex(planter->plantGrid.cols, j);
+// Disease, temperature, irrigation and weather: the grids step at their own rates, after the plants
+// are up to date, and the irrigation is solved when it changed. The plants only take the result of
+// the frame: the ones whose planter got or got over the disease, went to another PlantTemperature
+// or got another flow of water, are brought up to date and stored with it. The rain is a flow too,
+// for the planters in the open: when it starts or stops, it is one pass over the planters that
+// only stores the plants in the mask
+
+static bool planterHasPlants(const Garden *garden, int planterIndex) {
+    for (int plantIndex = 0; plantIndex < PLANTER_MAX_PLANTS; plantIndex++) {
+        if (garden->plants.exists[garden_getPlantId(planterIndex, plantIndex)]) {
+            return true;
+        }
+    }
 
-                        Vector2 planterWorldPos = getPlanterWorldPos(garden, planter->coords);
+    return false;
+}
 
-                        planterWorldPos.y -= planterDefinitions[planter->type].plantBasePosY;
+/// Makes the tiles of the planters with plants the hosts of the disease
+static void updateDiseaseHosts(Garden *garden) {
+    diseaseGrid_clearHosts(&garden->disease);
 
-                        IsoTransform localTransform = {
-                            planterWorldPos,
-                            SCENE_TRANSFORM.rotation,
-                            SCENE_TRANSFORM.scale,
-                        };
+    for (int planterIndex = 0; planterIndex < GARDEN_MAX_TILES; planterIndex++) {
+        const Planter *planter = &garden->planters[planterIndex];
 
-                        IsoRec isoRec = grid_toIsoRec(&localTransform,
-                            plantCoords,
-                            (Vector2){1, 1},
-                            planter->plantGrid.tileWidth,
-                            planter->plantGrid.tileHeight);
+        if (!planter->exists || !planterHasPlants(garden, planterIndex)) {
+            continue;
+        }
 
-                        drawIsoRectangleLines(garden, isoRec, 1, RED);
-                    }
-                }
+        Vector2 size = planter_getFootPrint(planter->type, planter->rotation);
+
+        for (int x = planter->coords.x; x < planter->coords.x + size.x; x++) {
+            for (int y = planter->coords.y; y < planter->coords.y + size.y; y++) {
+                diseaseGrid_setHost(&garden->disease, x, y);
             }
         }
     }
+}
 
-    for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
-        IsoRec currentTile = getTileIsoVertices(garden, i);
+/// Whether any tile of the planter is infected, and the PlantTemperature and the PlantLight of the
+/// average of them
+static void getPlanterConditions(const Garden *garden,
+    const Planter *planter,
+    bool *infected,
+    PlantTemperature *temperature,
+    PlantLight *light) {
+    Vector2 size = planter_getFootPrint(planter->type, planter->rotation);
+    float temperatureSum = 0;
+    float lightSum = 0;
+    int tilesCount = 0;
+
+    *infected = false;
+
+    for (int x = planter->coords.x; x < planter->coords.x + size.x; x++) {
+        for (int y = planter->coords.y; y < planter->coords.y + size.y; y++) {
+            if (x >= GARDEN_COLS || y >= GARDEN_ROWS) {
+                continue;
+            }
 
-        if (drawTileBounds) {
-            drawIsoRectangleLines(garden, currentTile, 1, (Color){255, 109, 194, 50});
+            *infected = *infected || diseaseGrid_isInfected(&garden->disease, x, y);
+            temperatureSum += temperatureField_get(&garden->temperature, x, y);
+            lightSum += lightIntegral_getAverage(&garden->light, x, y);
+            tilesCount++;
         }
+    }
 
-        if (showZIndexOnTile) {
-            Vector2 tileCoords = grid_getCoordsFromTileIndex(GARDEN_COLS, i);
+    *temperature = tilesCount > 0 ? plant_getTemperature(temperatureSum / tilesCount)
+                                  : PLANT_TEMPERATURE_MILD;
 
-            int zIndex = grid_getZIndex(
-                SCENE_TRANSFORM.rotation, tileCoords.x, tileCoords.y, GARDEN_COLS, GARDEN_ROWS);
+    // until the first day ends there is only the light of the morning, so it doesn't count yet
+    *light = tilesCount > 0 && garden->light.daysCount > 0 ? plant_getLight(lightSum / tilesCount)
+                                                           : PLANT_LIGHT_FULL;
+}
 
-            snprintf(buffer, 8, "%d", zIndex);
+/// Updates the plants whose planter changed
+static void applyPlanterConditions(Garden *garden) {
+    const PlantStore *plants = &garden->plants;
 
-            DrawText(buffer,
-                currentTile.right.x - ((currentTile.right.x - currentTile.left.x) / 2),
-                currentTile.bottom.y - 20,
-                12,
-                WHITE);
+    for (int planterIndex = 0; planterIndex < GARDEN_MAX_TILES; planterIndex++) {
+        const Planter *planter = &garden->planters[planterIndex];
+
+        if (!planter->exists) {
+            continue;
         }
 
-        if (showZIndexOnEntity) {
-            Planter *planter = &garden->planters[i];
+        bool infected;
+        PlantTemperature temperature;
+        PlantLight light;
+        getPlanterConditions(garden, planter, &infected, &temperature, &light);
+        int irrigation = getPlanterIrrigation(garden, planterIndex);
 
-            if (planter->exists) {
-                int planterTileIndex = grid_getTileIndexFromCoords(
-                    GARDEN_COLS, GARDEN_ROWS, planter->coords.x, planter->coords.y);
+        for (int plantIndex = 0; plantIndex < PLANTER_MAX_PLANTS; plantIndex++) {
+            int plantId = garden_getPlantId(planterIndex, plantIndex);
 
-                int zIndex = getPlanterZIndex(garden, planterTileIndex);
+            if (!plants->exists[plantId]
+                || (plants->infected[plantId] == infected
+                    && plants->temperature[plantId] == temperature
+                    && plants->light[plantId] == light
+                    && plants->irrigation[plantId] == irrigation)) {
+                continue;
+            }
 
-                IsoRec planterTile = getTileIsoVertices(garden, planterTileIndex);
+            Plant plant = garden_getPlantById(garden, plantId);
+            plant.infected = infected;
+            plant.temperature = temperature;
+            plant.light = light;
+            plant.irrigation = irrigation;
+            setPlant(garden, plantId, &plant);
+        }
+    }
+}
 
-                snprintf(buffer, 8, "%d", zIndex);
+/// Returns whether it stepped
+static bool updateDisease(Garden *garden, double deltaTime) {
+    garden->diseaseElapsed += deltaTime;
 
-                DrawText(buffer,
-                    planterTile.bottom.x,
-                    planterTile.bottom.y - (int)(TILE_HEIGHT / 2),
-                    12,
-                    PURPLE);
+    if (garden->diseaseElapsed < garden->diseaseStepSeconds) {
+        return false;
+    }
 
-                for (int j = 0; j < planter->plantGrid.tileCount; j++) {
-                    if (planter->plants[j].exists) {
-                        Vector2 plantWorldPos = planter_getPlantDrawOrigin(planter, j);
+    updateDiseaseHosts(garden);
 
-                        int zIndex = getPlantZIndex(SCENE_TRANSFORM.rotation, planter, j);
+    while (garden->diseaseElapsed >= garden->diseaseStepSeconds) {
+        diseaseGrid_step(&garden->disease);
+        garden->diseaseElapsed -= garden->diseaseStepSeconds;
+    }
 
-                        snprintf(buffer, 8, "%d", zIndex);
+    return true;
+}
 
-                        DrawText(buffer, plantWorldPos.x, plantWorldPos.y, 12, PURPLE);
-                    }
-                }
-            }
+/// 0 at night, up to 1 at noon of the longest day. `timeOfDay` in game seconds
+static float getSunIntensity(const Garden *garden, int dayOfYear, float timeOfDay) {
+    float sun = sunPath_getPosition(&garden->sunPath, dayOfYear, timeOfDay).elevation;
+
+    return sun > 0 ? sun : 0;
+}
+
+/// Adds the sun of a step of the temperature to the light of the tiles, as much as they get
+static void addStepLight(Garden *garden, int dayOfYear, float sun) {
+    float sunHours = sun * GARDEN_TEMPERATURE_STEP_SECONDS * GAME_SECONDS_PER_RL_SECONDS / 3600;
+
+    lightIntegral_setDay(&garden->light, dayOfYear);
+
+    for (int y = 0; y < GARDEN_ROWS; y++) {
+        for (int x = 0; x < GARDEN_COLS; x++) {
+            float exposure = temperatureField_getExposure(&garden->temperature, x, y);
+            lightIntegral_add(&garden->light, x, y, sunHours * exposure);
         }
+    }
+}
 
-        if (showPlanterIndexOnTile) {
-            int planterIndex = garden->tiles[i].planterIndex;
+/// Steps the temperature of the tiles, each step with the sun of its day and time of day, and
+/// adds the sun to their light. The frame ends at `timeOfDay` of `dayOfYear`. Returns whether it
+/// stepped
+static bool updateTemperature(Garden *garden, double deltaTime, int dayOfYear, float timeOfDay) {
+    garden->temperatureElapsed += deltaTime;
 
-            if (planterIndex != -1) {
+    if (garden->temperatureElapsed < GARDEN_TEMPERATURE_STEP_SECONDS) {
+        return false;
+    }
 
-                snprintf(buffer, 8, "%d", planterIndex);
+    while (garden->temperatureElapsed >= GARDEN_TEMPERATURE_STEP_SECONDS) {
+        garden->temperatureElapsed -= GARDEN_TEMPERATURE_STEP_SECONDS;
 
-                DrawText(buffer,
-                    currentTile.right.x - ((currentTile.right.x - currentTile.left.x) / 2),
-                    currentTile.bottom.y - ((currentTile.bottom.y - currentTile.top.y) / 2),
-                    20,
-                    WHITE);
+        double gameSecondsAgo = garden->temperatureElapsed * GAME_SECONDS_PER_RL_SECONDS;
+        double stepTime = timeOfDay - gameSecondsAgo;
+        // 0, or how many days before the end of the frame the step was
+        double daysAgo = floor(stepTime / SECONDS_IN_A_DAY);
+        float stepTimeOfDay = stepTime - daysAgo * SECONDS_IN_A_DAY;
+        int stepDay = (dayOfYear + (int)daysAgo % DAYS_IN_A_YEAR + DAYS_IN_A_YEAR) % DAYS_IN_A_YEAR;
+
+        float sun = getSunIntensity(garden, stepDay, stepTimeOfDay)
+                  * weather_getSunShare(garden->weather.state);
+        float air = lerp(GARDEN_AIR_TEMPERATURE_NIGHT, GARDEN_AIR_TEMPERATURE_NOON, sun);
+
+        temperatureField_step(&garden->temperature, sun, air);
+        addStepLight(garden, stepDay, sun);
+    }
+
+    return true;
+}
+
+/// Works out the covered tiles and the planters in the open again if the roof or a planter
+/// changed, and the sun the tiles get. Returns whether it did
+static bool updateCoverage(Garden *garden) {
+    if (!garden->coverageDirty) {
+        return false;
+    }
+
+    memcpy(garden->covered, garden->roof, sizeof(garden->covered));
+    memset(&garden->uncoveredPlanters, 0, sizeof(garden->uncoveredPlanters));
+
+    for (int pass = 0; pass < 2; pass++) {
+        for (int planterIndex = 0; planterIndex < GARDEN_MAX_TILES; planterIndex++) {
+            const Planter *planter = &garden->planters[planterIndex];
+
+            // the furniture first, then the planters it can cover
+            if (!planter->exists || planterDefinitions[planter->type].covers != (pass == 0)) {
+                continue;
             }
-        }
 
-        if (showPlantIndexOnPlanter) {
-            int planterIndex = i;
-            Planter *planter = &garden->planters[planterIndex];
+            Vector2 size = planter_getFootPrint(planter->type, planter->rotation);
+
+            for (int x = planter->coords.x; x < planter->coords.x + size.x; x++) {
+                for (int y = planter->coords.y; y < planter->coords.y + size.y; y++) {
+                    int tileIndex = grid_getTileIndexFromCoords(GARDEN_COLS, GARDEN_ROWS, x, y);
 
-            if (planter->exists) {
+                    if (tileIndex == -1) {
+                        continue;
+                    }
 
-                for (int plantIndex = 0; plantIndex < planter->plantGrid.tileCount; plantIndex++) {
-                    Vector2 plantDrawOrigin = planter_getPlantDrawOrigin(planter, plantIndex);
-                    snprintf(buffer, 11, "%d", plantIndex);
-                    DrawText(buffer, plantDrawOrigin.x, plantDrawOrigin.y, 20, WHITE);
+                    uint64_t bit = (uint64_t)1 << (tileIndex % 64);
+
+                    if (pass == 0) {
+                        garden->covered[tileIndex / 64] |= bit;
+                    } else if (!(garden->covered[tileIndex / 64] & bit)) {
+                        garden_addPlanterToMask(&garden->uncoveredPlanters, planterIndex);
+                    }
                 }
             }
         }
     }
 
-    snprintf(buffer, 8, "GR %d", SCENE_TRANSFORM.rotation);
-    DrawText(buffer, 600, 0, 20, WHITE);
-    snprintf(buffer, 8, "SR %d", garden->selectionRotation);
-    DrawText(buffer, 600, 30, 20, WHITE);
+    for (int tileIndex = 0; tileIndex < GARDEN_TILE_COUNT; tileIndex++) {
+        Vector2 coords = grid_getCoordsFromTileIndex(GARDEN_COLS, tileIndex);
+        bool covered = garden->covered[tileIndex / 64] >> (tileIndex % 64) & 1;
 
-    // DrawCircle(garden->lightSourcePos.x,
-    //     garden->lightSourcePos.y,
-    //     LIGHT_SOURCE_RADIUS * SCENE_TRANSFORM.scale,
-    //     YELLOW);
+        temperatureField_setExposure(
+            &garden->temperature, coords.x, coords.y, covered ? GARDEN_COVERED_EXPOSURE : 1);
+    }
+
+    garden->coverageDirty = false;
+
+    return true;
 }
+
+/// Solves the irrigation if a piece or a planter changed. Returns whether it did
+static bool updateIrrigation(Garden *garden) {
+    if (!garden->irrigation.dirty) {
+        return false;
+    }
+
+    irrigationNetwork_solve(&garden->irrigation);
+
+    return true;
+}
+
+/// Simulates the plants for `deltaTime` more seconds, with the LOD tiers of `view`. The frame ends
+/// at `timeOfDay`, in game seconds, of `dayOfYear`. Doesn't touch anything global, so it can run
+/// away from the thread that draws (see sim_thread.h)
+void garden_updatePlants(
+    Garden *garden, double deltaTime, int dayOfYear, float timeOfDay, const GardenView *view) {
+    bool tierDue[GARDEN_LOD_TIER_COUNT];
+    updateLodTiers(garden, view);
+    updateLodTimers(garden, deltaTime, tierDue);
+
+    updatePlants(garden, deltaTime, tierDue);
+
+    // the coverage and the weather first, the temperature steps with them
+    bool coverageChanged = updateCoverage(garden);
+    bool weatherChanged = weather_update(&garden->weather, deltaTime);
+    bool diseaseStepped = updateDisease(garden, deltaTime);
+    bool temperatureStepped = updateTemperature(garden, deltaTime, dayOfYear, timeOfDay);
+    bool irrigationSolved = updateIrrigation(garden);
+
+    if (coverageChanged || weatherChanged || diseaseStepped || temperatureStepped
+        || irrigationSolved) {
+        applyPlanterConditions(garden);
+    }
+}
+
+void garden_update(Garden *garden, float deltaTime, int dayOfYear, float gameplayTime) {
+    garden_updateLight(garden, dayOfYear, gameplayTime);
+
+    GardenView view = garden_getView(garden);
+    garden_updatePlants(garden, deltaTime, dayOfYear, gameplayTime, &view);
+}
+
+void garden_writeSnapshot(const Garden *garden, GardenSnapshot *snapshot) {
+    snapshot->plants = garden->plants;
+    snapshot->plantScheduler = garden->plantScheduler;
+    memcpy(snapshot->planterLodTier, garden->planterLodTier, sizeof(snapshot->planterLodTier));
+    snapshot->temperature = garden->temperature;
+    snapshot->light = garden->light;
+    snapshot->weather = garden->weather;
+}
+
+/// Replaces the plants of `garden` with the ones of the snapshot. The rest of the garden (the
+/// planters, the selection...) is left as is
+void garden_readSnapshot(Garden *garden, const GardenSnapshot *snapshot) {
+    garden->plants = snapshot->plants;
+    garden->plantScheduler = snapshot->plantScheduler;
+    memcpy(garden->planterLodTier, snapshot->planterLodTier, sizeof(garden->planterLodTier));
+    garden->temperature = snapshot->temperature;
+    garden->light = snapshot->light;
+    garden->weather = snapshot->weather;
+}
+
+/// Moves the wheels `seconds` without ticking anything, the plants are left behind until synced
+static void skipPlantWheels(Garden *garden, double seconds) {
+    PlantScheduler *scheduler = &garden->plantScheduler;
+
+    plantScheduler_advance(scheduler, seconds);
+
+    for (int type = 0; type < PLANT_TYPE_COUNT; type++) {
+        long ticksBySlot[PLANT_SCHEDULER_SLOTS];
+        plantScheduler_skipDueSlots(scheduler, type, ticksBySlot);
+    }
+}
+
+/// Simulates `seconds` that passed while the game was not running, i.e. when resuming a garden.
+/// The disease doesn't spread meanwhile, the infected plants stay so all that time, and the same
+/// with the temperature. The drippers do keep watering, their flow is part of the update of the
+/// plants. The weather goes on with its schedule: at each start and end of a rain the planters in
+/// the open are synced up to it and get their new irrigation, the rest of the plants are synced
+/// once at the end. Each sync jumps the whole stretch with plant_advanceTicks
+void garden_catchUp(Garden *garden, double seconds) {
+    while (seconds > 0) {
+        double step = garden->weather.secondsLeft < seconds ? garden->weather.secondsLeft : seconds;
+        bool wasRaining = garden->weather.state == WEATHER_RAIN;
+
+        skipPlantWheels(garden, step);
+        weather_update(&garden->weather, step);
+        seconds -= step;
+
+        if ((garden->weather.state == WEATHER_RAIN) != wasRaining) {
+            applyPlanterConditions(garden);
+        }
+    }
+
+    for (int plantId = 0; plantId < GARDEN_MAX_PLANTS; plantId++) {
+        if (garden->plants.exists[plantId]) {
+            syncPlant(garden, plantId);
+        }
+    }
+}
+
+// State hash: whatever the simulation (and the player through it) changes, for determinism checks
+// (see bench/garden_hash.c). It is cheap enough to take after every update: the plants, their
+// places in the wheels and their events, and the planters, are most of the state, and their hashes
+// are kept a plant or a planter at a time (see PlantStore.hash), so only the ones that changed are
+// hashed again. The grids of the tiles, that change as a whole every step anyway, and a few
+// counters are hashed when asked. The plants are the ones in the store: a run in
+// PLANT_SIMULATION_EVENTS hashes different from one in PLANT_SIMULATION_TICKS, both give the same
+// stream every time
+
+#define HASH_ARRAY(hash, array) utils_hash(hash, array, sizeof(array))
+
+/// Hash of the state of the planters, the plants and their clocks. Not const: it brings the hash of
+/// the plants up to date
+uint64_t garden_getStateHash(Garden *garden) {
+    uint64_t parts[] = {
+        garden->plantersHash,
+        plantStore_getHash(&garden->plants),
+        garden->plantScheduler.hash,
+        garden->plantEvents.hash,
+        garden->propagationRandom,
+        garden->disease.random,
+        garden->weather.state,
+        garden->weather.random,
+        garden->plantSimulationMode,
+    };
+
+    uint64_t hash = HASH_ARRAY(0, parts);
+
+    // only the words of the garden in the current buffers, the grid is sized for much bigger ones
+    const DiseaseGrid *disease = &garden->disease;
+
+    for (int y = 0; y < disease->rows; y++) {
+        size_t rowSize = disease->rowWords * sizeof(uint64_t);
+        hash = utils_hash(hash, disease->infected[disease->current][y], rowSize);
+        hash = utils_hash(hash, disease->susceptible[disease->current][y], rowSize);
+    }
+
+    hash = HASH_ARRAY(hash, garden->irrigation.pieces);
+    hash = HASH_ARRAY(hash, garden->irrigation.flow);
+    hash = utils_hash(hash, &garden->weather.secondsLeft, sizeof(double));
+    hash = HASH_ARRAY(hash, garden->roof);
+    hash = HASH_ARRAY(hash, garden->covered);
+    hash = HASH_ARRAY(hash, garden->uncoveredPlanters.bits);
+
+    // only the tiles, the vectors leave what depends on their width past the border
+    const TemperatureField *temperature = &garden->temperature;
+
+    for (int y = 1; y <= temperature->rows; y++) {
+        const float *row = &temperature->temperature[temperature->current][y][1];
+        hash = utils_hash(hash, row, temperature->cols * sizeof(float));
+    }
+
+    hash = utils_hash(hash, &garden->light.day, sizeof(int));
+    hash = HASH_ARRAY(hash, garden->light.today);
+    hash = HASH_ARRAY(hash, garden->light.daysSum);
+
+    const PlantScheduler *scheduler = &garden->plantScheduler;
+    hash = HASH_ARRAY(hash, scheduler->slotsPopped);
+    hash = HASH_ARRAY(hash, scheduler->elapsed);
+
+    hash = HASH_ARRAY(hash, garden->planterLodTier);
+    hash = HASH_ARRAY(hash, garden->lodElapsed);
+
+    return hash;
+}
+
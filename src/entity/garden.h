@@ -5,12 +5,17 @@
 #include "../game/scenes/scene.h"
 #include "../input/input.h"
 #include "../messages/messages.h"
+#include "../utils/raylib_types.h"
+#include "disease_grid.h"
+#include "irrigation_network.h"
+#include "light_integral.h"
+#include "plant_event_queue.h"
+#include "plant_scheduler.h"
+#include "plant_store.h"
 #include "planter.h"
-#include <raylib.h>
-
-#define GARDEN_MAX_COLS 20
-#define GARDEN_MAX_ROWS 20
-#define GARDEN_MAX_TILES (GARDEN_MAX_COLS * GARDEN_MAX_ROWS)
+#include "sun_path.h"
+#include "temperature_field.h"
+#include "weather.h"
 
 // TODO: maybe export to it's own file
 // Maybe don't use this lol
@@ -19,6 +24,59 @@ typedef struct {
     int lightLevel;
 } GardenTile;
 
+typedef enum {
+    /// every plant gets a tick each time its wheel passes over its slot
+    PLANT_SIMULATION_TICKS,
+    /// plants are only updated when one of their levels changes or the player does something to
+    /// them. The stats in the store are the ones of the last update, use garden_getPlant to read
+    /// the current ones
+    PLANT_SIMULATION_EVENTS,
+} PlantSimulationMode;
+
+/// Seconds between the steps of the disease by default, see Garden.diseaseStepSeconds
+#define GARDEN_DISEASE_STEP_SECONDS_DEFAULT 5.0f
+
+/// seconds of plant time between the steps of the temperature of the tiles
+#define GARDEN_TEMPERATURE_STEP_SECONDS 1.0f
+/// degrees of the air at night and at noon, see Garden.temperature
+#define GARDEN_AIR_TEMPERATURE_NIGHT 8.0f
+#define GARDEN_AIR_TEMPERATURE_NOON 16.0f
+
+/// seed of the weather of a new garden
+#define GARDEN_WEATHER_SEED 1
+/// share of the sun that gets to a covered tile, see Garden.covered
+#define GARDEN_COVERED_EXPOSURE 0.25f
+
+/// Seconds an off screen planter can fall behind by default, see Garden.lodMaxLag
+#define GARDEN_LOD_MAX_LAG_DEFAULT 2.0f
+
+/// How often the plants of a planter are updated, by how far it is from the view
+typedef enum {
+    /// on screen or selected: every frame
+    GARDEN_LOD_TIER_VISIBLE,
+    /// less than a view away: every `lodMaxLag / 4` seconds
+    GARDEN_LOD_TIER_NEAR,
+    /// every `lodMaxLag` seconds
+    GARDEN_LOD_TIER_FAR,
+    GARDEN_LOD_TIER_COUNT,
+} GardenLodTier;
+
+/// What the sim LOD looks at to put the planters in their tiers
+typedef struct {
+    IsoTransform transform;
+    /// -1 when there is none
+    int planterSelected;
+} GardenView;
+
+#define GARDEN_PLANTER_MASK_WORDS ((GARDEN_MAX_TILES + 63) / 64)
+
+/// A set of planters, a bit by planter index
+typedef struct {
+    uint64_t bits[GARDEN_PLANTER_MASK_WORDS];
+} GardenPlanterMask;
+
+#define GARDEN_TILE_MASK_WORDS ((GARDEN_MAX_TILES + 63) / 64)
+
 typedef struct {
     GardenTile tiles[GARDEN_MAX_TILES];
     int tileSelected;
@@ -26,15 +84,187 @@ typedef struct {
     int planterPickedUpIndex;
     int planterTileHovered;
     Planter planters[GARDEN_MAX_TILES];
+    /// of each planter and all of them XORed, kept up to date by the changes of the sim (see
+    /// garden_getStateHash)
+    uint64_t planterHash[GARDEN_MAX_TILES];
+    uint64_t plantersHash;
+    PlantStore plants;
     Vector2 lightSourcePos;
     int lightSourceLevel;
+    /// where the light is with the day of the year and the time of day
+    SunPath sunPath;
     Rotation selectionRotation;
+    PlantScheduler plantScheduler;
+    PlantSimulationMode plantSimulationMode;
+    PlantEventQueue plantEvents;
+    /// size of the render target, for the view bounds of the sim LOD
+    Vector2 viewSize;
+    /// accuracy bound of the sim LOD: the most seconds the plants of a planter off screen can be
+    /// behind. 0 updates every planter every frame
+    float lodMaxLag;
+    GardenLodTier planterLodTier[GARDEN_MAX_TILES];
+    /// false for planters that are new since the last time the tiers were worked out
+    bool planterLodClassified[GARDEN_MAX_TILES];
+    double lodElapsed[GARDEN_LOD_TIER_COUNT];
+    /// view and selection the tiers were worked out for
+    GardenView lodView;
+    /// state of the random numbers of the genetics, so the offspring of the same plants are the
+    /// same in every run (see garden_propagatePlant)
+    uint64_t propagationRandom;
+    /// diseases and pests by tile, the tiles of the planters with plants are the hosts. A plant
+    /// is infected while any tile of its planter is
+    DiseaseGrid disease;
+    /// seconds of plant time between the steps of `disease`
+    float diseaseStepSeconds;
+    double diseaseElapsed;
+    /// of the tiles, warmer than the air by day. The plants take the one of their planter
+    TemperatureField temperature;
+    double temperatureElapsed;
+    /// sun the tiles got, added up at the steps of `temperature`
+    LightIntegral light;
+    /// pipes and drippers, laid in GAMEPLAY_MODE_IRRIGATION. Solved again when a piece or a
+    /// planter changes, the plants take the flow of the drippers of their planter
+    IrrigationNetwork irrigation;
+    Weather weather;
+    /// roof over the garden, a bit by tile index
+    uint64_t roof[GARDEN_TILE_MASK_WORDS];
+    /// tiles under the roof or furniture that covers them (see PlanterDefinition.covers), which
+    /// get less sun. Worked out again when the roof or a planter changes, with `uncoveredPlanters`
+    uint64_t covered[GARDEN_TILE_MASK_WORDS];
+    /// planters with any tile not covered, the ones the rain waters
+    GardenPlanterMask uncoveredPlanters;
+    bool coverageDirty;
 } Garden;
 
-void garden_init(Garden *garden, Vector2 *screenSize, float gameplayTime);
+typedef enum {
+    GARDEN_CARE_IRRIGATE,
+    GARDEN_CARE_FEED,
+} GardenCare;
+
+/// The tiles up to `radius` tiles away from the tile at (`x`, `y`): a square, or a circle if
+/// `round`
+typedef struct {
+    int x;
+    int y;
+    int radius;
+    bool round;
+} GardenArea;
+
+typedef enum {
+    GARDEN_COMMAND_ADD_PLANT,
+    /// adds a plant from a cutting, see garden_propagatePlant
+    GARDEN_COMMAND_PROPAGATE_PLANT,
+    GARDEN_COMMAND_REMOVE_PLANT,
+    GARDEN_COMMAND_IRRIGATE_PLANT,
+    GARDEN_COMMAND_FEED_PLANT,
+    GARDEN_COMMAND_PRUNE_PLANT,
+    /// a planter was placed or moved
+    GARDEN_COMMAND_SET_PLANTER,
+    GARDEN_COMMAND_REMOVE_PLANTER,
+    /// waters or feeds every plant of a set of planters at once, see garden_careForPlanters
+    GARDEN_COMMAND_CARE_FOR_PLANTERS,
+    /// lays or takes away a piece of the irrigation, see garden_setIrrigationPiece
+    GARDEN_COMMAND_SET_IRRIGATION_PIECE,
+    /// puts up or takes down the roof over a tile, see garden_setRoof
+    GARDEN_COMMAND_SET_ROOF,
+} GardenCommandType;
+
+typedef union {
+    struct {
+        int planterIndex;
+        int plantIndex;
+        enum PlantType type;
+    } plant;
+    struct {
+        int planterIndex;
+        Planter planter;
+    } planter;
+    struct {
+        GardenCare care;
+        GardenPlanterMask planters;
+    } care;
+    struct {
+        int x;
+        int y;
+        IrrigationPiece piece;
+    } irrigation;
+    struct {
+        int x;
+        int y;
+        bool roofed;
+    } roof;
+} GardenCommandArgs;
+
+/// Something done to the plants or planters of the simulation. The game sends them to the sim
+/// thread (see sim_thread.h), anything else runs them with garden_runCommand
+typedef struct {
+    GardenCommandType type;
+    GardenCommandArgs args;
+} GardenCommand;
+
+/// What a plant can be short of, to find the ones that need the player (see PlantStore.levelIndex
+/// and PlantStore.underfed)
+typedef enum {
+    /// hydration below the optimal level
+    GARDEN_NEED_WATER,
+    /// nutrition below the optimal level of the plant, see PlantTraits
+    GARDEN_NEED_NUTRIENTS,
+    /// dying, but not dead yet
+    GARDEN_NEED_HEALTH,
+    GARDEN_NEED_COUNT,
+} GardenNeed;
+
+/// The part of a garden the plant simulation changes, enough to read the plants (with
+/// garden_getPlantById) and their tiers. See sim_thread.h
+typedef struct {
+    PlantStore plants;
+    PlantScheduler plantScheduler;
+    GardenLodTier planterLodTier[GARDEN_MAX_TILES];
+    TemperatureField temperature;
+    LightIntegral light;
+    Weather weather;
+} GardenSnapshot;
+
+void garden_init(Garden *garden, Vector2 *screenSize, int dayOfYear, float gameplayTime);
 Message garden_processInput(Garden *garden, InputManager *input);
-void garden_draw(Garden *garden, enum GardeningTool toolSelected, int toolVariantSelected);
-void garden_update(Garden *garden, float deltaTime, float gameplayTime);
+void garden_draw(Garden *garden,
+    enum GameplayMode mode,
+    enum GardeningTool toolSelected,
+    int toolVariantSelected);
+void garden_update(Garden *garden, float deltaTime, int dayOfYear, float gameplayTime);
+void garden_updateLight(Garden *garden, int dayOfYear, float gameplayTime);
+void garden_updatePlants(Garden *garden,
+    double deltaTime,
+    int dayOfYear,
+    float timeOfDay,
+    const GardenView *view);
+GardenView garden_getView(const Garden *garden);
+void garden_writeSnapshot(const Garden *garden, GardenSnapshot *snapshot);
+void garden_readSnapshot(Garden *garden, const GardenSnapshot *snapshot);
+void garden_catchUp(Garden *garden, double seconds);
 bool garden_hasPlanterSelected(const Garden *garden);
 Planter *garden_getSelectedPlanter(Garden *garden);
+int garden_getPlantId(int planterIndex, int plantIndex);
+Plant garden_getPlant(const Garden *garden, int planterIndex, int plantIndex);
+Plant garden_getPlantById(const Garden *garden, int plantId);
+void garden_addPlant(Garden *garden, int planterIndex, int plantIndex, enum PlantType type);
+void garden_propagatePlant(Garden *garden, int planterIndex, int plantIndex, enum PlantType type);
+void garden_removePlant(Garden *garden, int planterIndex, int plantIndex);
+void garden_irrigatePlant(Garden *garden, int planterIndex, int plantIndex);
+void garden_feedPlant(Garden *garden, int planterIndex, int plantIndex);
+void garden_prunePlant(Garden *garden, int planterIndex, int plantIndex);
+void garden_removePlanter(Garden *garden, int planterIndex);
+void garden_addPlanterToMask(GardenPlanterMask *mask, int planterIndex);
+void garden_getPlantersInArea(const Garden *garden, GardenArea area, GardenPlanterMask *mask);
+void garden_careForPlanters(Garden *garden, GardenCare care, const GardenPlanterMask *planters);
+void garden_setIrrigationPiece(Garden *garden, int x, int y, IrrigationPiece piece);
+void garden_setRoof(Garden *garden, int x, int y, bool roofed);
+void garden_runCommand(Garden *garden, const GardenCommand *command);
 void garden_updateGardenOrigin(Garden *garden, Vector2 *screenSize);
+IsoRec garden_getIsoVertices(const Garden *garden);
+IsoRec garden_getTileIsoVertices(const Garden *garden, int tileIndex);
+int garden_countPlantsInNeed(const Garden *garden, GardenNeed need);
+int garden_findNextPlantInNeed(const Garden *garden, GardenNeed need, int afterPlantId);
+void garden_setPlantSimulationMode(Garden *garden, PlantSimulationMode mode);
+void garden_drawLodCounters(const Garden *garden, Vector2 screenSize);
+uint64_t garden_getStateHash(Garden *garden);
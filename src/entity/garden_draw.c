@@ -0,0 +1,666 @@
+#include "garden.h"
+#include "../core/asset_manager.h"
+#include "../game/constants.h"
+#include "../game/gameplay.h"
+#include "../ui/ui_text_box.h"
+#include "plant.h"
+#include "planter.h"
+#include <assert.h>
+#include <raylib.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Drawing and input of the garden. Everything here needs raylib, the simulation (garden.c) doesn't
+// and is built without it too (see libgarden in the Makefile)
+
+#define LIGHT_SOURCE_RADIUS 40
+
+IsoRec getPlanterIsoVertices(const Garden *garden, int tileIndex) {
+    int planterIndex = garden->tiles[tileIndex].planterIndex;
+    const Planter *p = &garden->planters[planterIndex];
+
+    IsoRec isoRec = grid_toIsoRec(&SCENE_TRANSFORM,
+        p->coords,
+        planter_getFootPrint(p->type, p->rotation),
+        TILE_WIDTH,
+        TILE_HEIGHT);
+
+    return isoRec;
+}
+
+IsoRec getHoveredIsoVertices(
+    const Garden *garden, int tileIndex, enum GardeningTool tool, int toolVariant) {
+
+    Vector2 coords = grid_getCoordsFromTileIndex(GARDEN_COLS, tileIndex);
+    Vector2 dimensions = {1, 1};
+
+    if (tool == GARDENING_TOOL_PLANTER) {
+        dimensions = planter_getFootPrint(toolVariant, garden->selectionRotation);
+
+    } else if (tool == GARDENING_TOOL_IRRIGATION) {
+        // pieces go on single tiles, planter or not
+
+    } else if (tool == GARDENING_TOOL_NONE && garden->planterPickedUpIndex != -1) {
+        const Planter *p = &garden->planters[garden->planterPickedUpIndex];
+        dimensions = planter_getFootPrint(p->type, garden->selectionRotation);
+
+    } else if (garden->tiles[tileIndex].planterIndex != -1) {
+        const Planter *p = &garden->planters[garden->tiles[tileIndex].planterIndex];
+        dimensions = planter_getFootPrint(p->type, p->rotation);
+        coords = p->coords;
+    }
+
+    IsoRec isoRec = grid_toIsoRec(&SCENE_TRANSFORM, coords, dimensions, TILE_WIDTH, TILE_HEIGHT);
+
+    return isoRec;
+}
+
+Vector2 getPlanterWorldPos(Garden *garden, Vector2 planterCoords) {
+    int tileIndex
+        = grid_getTileIndexFromCoords(GARDEN_COLS, GARDEN_ROWS, planterCoords.x, planterCoords.y);
+
+    IsoRec irec = getPlanterIsoVertices(garden, tileIndex);
+
+    return (Vector2){irec.left.x, irec.left.y};
+}
+
+Vector2 getPlanterDrawPos(Garden *garden, Vector2 planterCoords) {
+    int tileIndex
+        = grid_getTileIndexFromCoords(GARDEN_COLS, GARDEN_ROWS, planterCoords.x, planterCoords.y);
+
+    IsoRec planterRec = getPlanterIsoVertices(garden, tileIndex);
+
+    return (Vector2){planterRec.left.x, planterRec.top.y};
+}
+
+void garden_drawLodCounters(const Garden *garden, Vector2 screenSize) {
+    UITextBox uiTextBox;
+    uiTextBox_init(&uiTextBox,
+        debugFont,
+        debugFont.baseSize,
+        (Rectangle){screenSize.x - 300, screenSize.y / 2, 300, screenSize.y / 2},
+        (Vector2){10, 10});
+
+    int plantsByTier[GARDEN_LOD_TIER_COUNT] = {0};
+
+    for (int plantId = 0; plantId < GARDEN_MAX_PLANTS; plantId++) {
+        if (garden->plants.exists[plantId]) {
+            plantsByTier[garden->planterLodTier[plantId / PLANTER_MAX_PLANTS]]++;
+        }
+    }
+
+    const char *tierNames[GARDEN_LOD_TIER_COUNT] = {"visible", "near", "far"};
+    char buffer[64];
+
+    snprintf(buffer, 64, "sim LOD max lag: %.2fs", garden->lodMaxLag);
+    uiTextBox_drawTextLine(&uiTextBox, buffer, WHITE);
+
+    for (int tier = 0; tier < GARDEN_LOD_TIER_COUNT; tier++) {
+        snprintf(buffer, 64, "plants %s: %d", tierNames[tier], plantsByTier[tier]);
+        uiTextBox_drawTextLine(&uiTextBox, buffer, WHITE);
+    }
+}
+
+Message garden_processInput(Garden *garden, InputManager *input) {
+    Vector2 *mousePos = &input->worldMousePos;
+
+    Vector2 tileHoveredCoords = grid_worldPointToCoords(
+        &SCENE_TRANSFORM, mousePos->x, mousePos->y, TILE_WIDTH, TILE_HEIGHT);
+
+    int tileHoveredIndex = grid_getTileIndexFromCoords(
+        GARDEN_COLS, GARDEN_ROWS, tileHoveredCoords.x, tileHoveredCoords.y);
+
+    garden->tileHovered = tileHoveredIndex;
+
+    garden->planterTileHovered = -1;
+
+    if (garden->tileHovered != -1 && garden->tiles[garden->tileHovered].planterIndex != -1) {
+        int planterIndex = garden->tiles[garden->tileHovered].planterIndex;
+
+        if (planterIndex != -1) {
+            Planter *planter = &garden->planters[planterIndex];
+
+            if (planter->exists) {
+                Vector2 planterOrigin = grid_getTileOrigin(
+                    &SCENE_TRANSFORM, planter->coords, TILE_WIDTH, TILE_HEIGHT);
+
+                garden->planterTileHovered = planter_getPlantIndexFromWorldPos(
+                    planter, planterOrigin, input->worldMousePos);
+            }
+        }
+    }
+
+    if (tileHoveredIndex != -1
+        && input->mouseButtonState[MOUSE_BUTTON_LEFT] == MOUSE_BUTTON_STATE_PRESSED) {
+
+        return (Message){MESSAGE_EV_TILE_CLICKED, {.selection = tileHoveredIndex}};
+    }
+
+    return (Message){MESSAGE_NONE};
+}
+
+void drawIsoRectangleLines(Garden *garden, IsoRec isoRec, int lineWidth, Color color) {
+    DrawLineEx(isoRec.top, isoRec.left, 2, color);
+    DrawLineEx(isoRec.left, isoRec.bottom, 2, color);
+    DrawLineEx(isoRec.bottom, isoRec.right, 2, color);
+    DrawLineEx(isoRec.right, isoRec.top, 2, color);
+}
+
+static Vector2 getTileCenter(const Garden *garden, int x, int y) {
+    IsoRec isoRec = garden_getTileIsoVertices(
+        garden, grid_getTileIndexFromCoords(GARDEN_COLS, GARDEN_ROWS, x, y));
+
+    return (Vector2){(isoRec.left.x + isoRec.right.x) / 2, (isoRec.top.y + isoRec.bottom.y) / 2};
+}
+
+/// Pipes from the center of each tile to the edges shared with the tiles next to it with pieces,
+/// and the drippers (lighter with water) and taps on top
+static void drawIrrigation(const Garden *garden) {
+    const IrrigationNetwork *network = &garden->irrigation;
+    const float scale = SCENE_TRANSFORM.scale;
+    const int neighborOffsets[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+    for (int y = 0; y < GARDEN_ROWS; y++) {
+        for (int x = 0; x < GARDEN_COLS; x++) {
+            IrrigationPiece piece = irrigationNetwork_getPiece(network, x, y);
+
+            if (piece == IRRIGATION_PIECE_NONE) {
+                continue;
+            }
+
+            Vector2 center = getTileCenter(garden, x, y);
+
+            for (int i = 0; i < 4; i++) {
+                int nx = x + neighborOffsets[i][0];
+                int ny = y + neighborOffsets[i][1];
+
+                if (irrigationNetwork_getPiece(network, nx, ny) == IRRIGATION_PIECE_NONE) {
+                    continue;
+                }
+
+                Vector2 neighbor = getTileCenter(garden, nx, ny);
+                Vector2 edge = {(center.x + neighbor.x) / 2, (center.y + neighbor.y) / 2};
+
+                DrawLineEx(center, edge, 2 * scale, (Color){80, 80, 80, 255});
+            }
+
+            if (piece == IRRIGATION_PIECE_DRIPPER) {
+                bool watering = irrigationNetwork_getFlow(network, x, y) > 0;
+                Color color = watering ? SKYBLUE : GRAY;
+
+                DrawEllipse(center.x, center.y, 3 * scale, 1.5f * scale, color);
+            } else if (piece == IRRIGATION_PIECE_TAP) {
+                DrawEllipse(center.x, center.y, 5 * scale, 2.5f * scale, DARKBLUE);
+            }
+        }
+    }
+}
+
+typedef enum {
+    DRAWABLE_PLANTER,
+    DRAWABLE_PLANT,
+} DrawableType;
+
+typedef struct {
+    DrawableType type;
+    /// planter for planters
+    void *data;
+    int plantId;
+    Vector2 origin;
+    int tileDepth;
+    int localDepth;
+    bool highlight;
+    bool pickedUp;
+} Drawable;
+
+int compareDrawableDepths(const void *a, const void *b) {
+    const Drawable *da = a;
+    const Drawable *db = b;
+
+    // TODO: != ???? no deberia ser > ???
+    if (da->tileDepth != db->tileDepth) {
+        return da->tileDepth - db->tileDepth;
+    }
+
+    return da->localDepth - db->localDepth;
+}
+
+int getPlantZIndex(Rotation gardenRotation, Planter *planter, int plantIndex) {
+    Vector2 plantCoords = grid_getCoordsFromTileIndex(planter->plantGrid.cols, plantIndex);
+
+    int zIndex = grid_getZIndex(gardenRotation,
+        plantCoords.x,
+        plantCoords.y,
+        planter->plantGrid.cols,
+        planter->plantGrid.rows);
+
+    return zIndex;
+}
+
+int getPlanterZIndex(Garden *garden, int planterTileIndex) {
+    IsoRec planterIsoRec = getPlanterIsoVertices(garden, planterTileIndex);
+    Vector2 nearestTileCoords = grid_worldPointToCoords(&SCENE_TRANSFORM,
+        planterIsoRec.right.x - 1,
+        planterIsoRec.right.y,
+        TILE_WIDTH,
+        TILE_HEIGHT);
+
+    int zIndex = grid_getZIndex(SCENE_TRANSFORM.rotation,
+        nearestTileCoords.x,
+        nearestTileCoords.y,
+        GARDEN_COLS,
+        GARDEN_ROWS);
+
+    return zIndex;
+}
+
+/// In GAMEPLAY_MODE_IRRIGATION the planters and plants are see-through, with the irrigation over
+/// them
+void garden_draw(Garden *garden,
+    enum GameplayMode mode,
+    enum GardeningTool toolSelected,
+    int toolVariantSelected) {
+    assert(TILE_WIDTH > 0);
+    assert(TILE_HEIGHT > 0);
+    IsoRec hoveredTile = {{0, 0}, {0, 0}, {0, 0}, {0, 0}};
+    IsoRec selectedTile = {{0, 0}, {0, 0}, {0, 0}, {0, 0}};
+
+    int maxEntities = GARDEN_TILE_COUNT + (GARDEN_TILE_COUNT * PLANTER_MAX_PLANTS);
+
+    Drawable entitiesToDraw[maxEntities];
+    int entitiesToDrawCount = 0;
+
+    // Draw tiles and identify the hovered and selected tile
+    for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
+        IsoRec currentTile = garden_getTileIsoVertices(garden, i);
+
+        DrawTexturePro(slab1Texture,
+            (Rectangle){0, 0, slab1Texture.width, slab1Texture.height},
+            (Rectangle){
+                currentTile.left.x,
+                currentTile.top.y,
+                TILE_WIDTH * SCENE_TRANSFORM.scale,
+                TILE_HEIGHT * SCENE_TRANSFORM.scale,
+            },
+            (Vector2){0, 0},
+            0,
+            WHITE);
+
+        if (garden->tileSelected == i || garden->tileHovered == i) {
+            int planterIndex = garden->tiles[i].planterIndex;
+
+            if (garden->tileHovered == i) {
+                currentTile = getHoveredIsoVertices(garden, i, toolSelected, toolVariantSelected);
+            } else if (planterIndex != -1 && garden->planters[planterIndex].exists) {
+                currentTile = getPlanterIsoVertices(garden, i);
+            }
+
+            if (garden->tileSelected == i) {
+                selectedTile = currentTile;
+            }
+
+            if (garden->tileHovered == i) {
+                hoveredTile = currentTile;
+            }
+        }
+    }
+
+    // Draw garden outline
+    drawIsoRectangleLines(garden, garden_getIsoVertices(garden), 4, WHITE);
+
+    // Draw selection/hovered indicators
+    if (!(selectedTile.left.x == 0 && selectedTile.right.x == 0)) {
+        drawIsoRectangleLines(garden, selectedTile, 2, DARKBROWN);
+    }
+
+    if (!(hoveredTile.left.x == 0 && hoveredTile.right.x == 0)) {
+        BeginBlendMode(BLEND_ADDITIVE);
+
+        DrawTriangle(
+            hoveredTile.left, hoveredTile.bottom, hoveredTile.right, (Color){255, 255, 255, 40});
+        DrawTriangle(
+            hoveredTile.right, hoveredTile.top, hoveredTile.left, (Color){255, 255, 255, 40});
+        EndBlendMode();
+    }
+
+    if (mode == GAMEPLAY_MODE_NORMAL) {
+        drawIrrigation(garden);
+    }
+
+    GardenTile *tileHovered = &garden->tiles[garden->tileHovered];
+
+    // Get all the entities to draw
+    for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
+
+        Planter *planter = &garden->planters[i];
+
+        if (planter->exists) {
+            int isoTileIndex = grid_getTileIndexFromCoords(
+                GARDEN_COLS, GARDEN_ROWS, planter->coords.x, planter->coords.y);
+
+            Vector2 planterDrawPos = getPlanterDrawPos(garden, planter->coords);
+
+            int zIndex = getPlanterZIndex(garden, isoTileIndex);
+            bool pickedUp = i == garden->planterPickedUpIndex;
+            bool planterHighlight
+                = i == tileHovered->planterIndex && i != garden->planterPickedUpIndex;
+
+            entitiesToDraw[entitiesToDrawCount] = (Drawable){
+                .type = DRAWABLE_PLANTER,
+                .data = planter,
+                .origin = planterDrawPos,
+                .tileDepth = zIndex,
+                .highlight = planterHighlight,
+                .pickedUp = pickedUp,
+            };
+
+            entitiesToDrawCount++;
+
+            int plantsCount = planter->plantGrid.tileCount;
+            for (int j = 0; j < plantsCount; j++) {
+                int plantId = garden_getPlantId(i, j);
+
+                if (garden->plants.exists[plantId]) {
+                    Vector2 plantOrigin = planter_getPlantDrawOrigin(planter, j);
+
+                    entitiesToDraw[entitiesToDrawCount] = (Drawable){
+                        .type = DRAWABLE_PLANT,
+                        .plantId = plantId,
+                        .origin = plantOrigin,
+                        .tileDepth = zIndex,
+                        .localDepth = getPlantZIndex(SCENE_TRANSFORM.rotation, planter, j),
+                        .highlight = planterHighlight && i == tileHovered->planterIndex
+                                  && j == garden->planterTileHovered,
+                        .pickedUp = pickedUp,
+                    };
+
+                    entitiesToDrawCount++;
+                }
+            }
+        }
+    }
+
+    // Draw entities
+    qsort(entitiesToDraw, entitiesToDrawCount, sizeof(Drawable), compareDrawableDepths);
+
+    for (int i = 0; i < entitiesToDrawCount; i++) {
+        Vector2 origin = entitiesToDraw[i].origin;
+        Color color = entitiesToDraw[i].pickedUp ? (Color){255, 255, 255, 100} : WHITE;
+
+        if (mode == GAMEPLAY_MODE_IRRIGATION) {
+            color.a /= 3;
+        }
+
+        if (entitiesToDraw[i].type == DRAWABLE_PLANTER) {
+            Planter *p = entitiesToDraw[i].data;
+
+            planter_draw(p, origin, SCENE_TRANSFORM.scale, SCENE_TRANSFORM.rotation, color);
+
+            if (entitiesToDraw[i].highlight) {
+                BeginBlendMode(BLEND_ADDITIVE);
+                planter_draw(p,
+                    origin,
+                    SCENE_TRANSFORM.scale,
+                    SCENE_TRANSFORM.rotation,
+                    (Color){255, 255, 255, 100});
+                EndBlendMode();
+            }
+        } else {
+            Plant p = garden_getPlantById(garden, entitiesToDraw[i].plantId);
+
+            plant_draw(&p, origin, SCENE_TRANSFORM.scale, color);
+
+            if (entitiesToDraw[i].highlight) {
+                BeginBlendMode(BLEND_ADDITIVE);
+                plant_draw(&p, origin, SCENE_TRANSFORM.scale, (Color){255, 255, 255, 100});
+                EndBlendMode();
+            }
+        }
+    }
+
+    if (mode == GAMEPLAY_MODE_IRRIGATION) {
+        drawIrrigation(garden);
+    }
+
+    // Draw available slots to put a plant when a plant cutting is selected
+    if (toolSelected == GARDENING_TOOL_PLANT_CUTTING) {
+        for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
+            if (!garden->planters[i].exists) {
+                continue;
+            }
+
+            Planter *planter = &garden->planters[i];
+
+            for (int j = 0; j < planter->plantGrid.tileCount; j++) {
+                // don't draw slot indicator if the planter has a plant in that slot
+                if (garden->plants.exists[garden_getPlantId(i, j)]
+                    || (i == garden->tiles[garden->tileHovered].planterIndex
+                        && j == garden->planterTileHovered)) {
+                    continue;
+                }
+
+                Vector2 plantWorldPos = planter_getPlantDrawOrigin(planter, j);
+
+                DrawEllipse(plantWorldPos.x, plantWorldPos.y, 10, 5, (Color){255, 255, 255, 225});
+            }
+        }
+    }
+
+    // Draw item on hovered tile
+    if (garden->tileHovered != -1) {
+        int hoveredIndex = garden->tileHovered;
+
+        switch (toolSelected) {
+        case GARDENING_TOOL_NONE:
+            if (garden->planterPickedUpIndex != -1) {
+                Planter *originalPlanter = &garden->planters[garden->planterPickedUpIndex];
+
+                Vector2 drawOrigin = (Vector2){hoveredTile.left.x, hoveredTile.top.y};
+                Planter p = *originalPlanter;
+                Vector2 gridCoords = grid_getCoordsFromTileIndex(GARDEN_COLS, hoveredIndex);
+
+                Color color = {255, 255, 255, 200};
+
+                planter_init(
+                    &p, originalPlanter->type, gridCoords, garden->selectionRotation, TILE_WIDTH);
+
+                planter_draw(
+                    &p, drawOrigin, SCENE_TRANSFORM.scale, SCENE_TRANSFORM.rotation, color);
+
+                for (int i = 0; i < p.plantGrid.tileCount; i++) {
+                    Plant plant = garden_getPlant(garden, garden->planterPickedUpIndex, i);
+
+                    if (plant.exists) {
+                        Vector2 plantOrigin = planter_getPlantDrawOrigin(&p, i);
+
+                        plant_draw(&plant, plantOrigin, SCENE_TRANSFORM.scale, color);
+                    }
+                }
+            }
+
+            break;
+        case GARDENING_TOOL_PLANTER: {
+            Vector2 drawOrigin = (Vector2){hoveredTile.left.x, hoveredTile.top.y};
+            Planter p;
+            Vector2 gridCoords = grid_getCoordsFromTileIndex(GARDEN_COLS, hoveredIndex);
+
+            planter_init(
+                &p, toolVariantSelected, gridCoords, garden->selectionRotation, TILE_WIDTH);
+
+            planter_draw(&p,
+                drawOrigin,
+                SCENE_TRANSFORM.scale,
+                SCENE_TRANSFORM.rotation,
+                (Color){255, 255, 255, 200});
+        } break;
+
+        case GARDENING_TOOL_PLANT_CUTTING: {
+            int planterIndex = garden->tiles[hoveredIndex].planterIndex;
+            Planter *planter = &garden->planters[planterIndex];
+
+            Vector2 drawOrigin;
+
+            if (planterIndex != -1 && planter->exists && planter->plantGrid.tileCount > 0) {
+                drawOrigin = planter_getPlantDrawOrigin(planter, garden->planterTileHovered);
+
+            } else {
+                float plantBasePosY = TILE_HEIGHT * SCENE_TRANSFORM.scale / 2.0f;
+
+                drawOrigin = (Vector2){
+                    hoveredTile.bottom.x,
+                    hoveredTile.bottom.y - plantBasePosY,
+                };
+            }
+
+            Plant plant = {.health = PLANT_STAT(100)};
+            plant_init(&plant, toolVariantSelected);
+            plant_draw(&plant, drawOrigin, SCENE_TRANSFORM.scale, (Color){255, 255, 255, 200});
+        } break;
+
+        case GARDENING_TOOL_COUNT:
+            assert(false);
+
+        default:
+            break;
+        }
+    }
+
+    // drawings for debug - maybe refactor into something to control this on runtime?
+
+    bool showZIndexOnTile = false;
+    bool showZIndexOnEntity = false;
+    bool showPlanterIndexOnTile = false;
+    bool showPlantIndexOnPlanter = true;
+    bool drawTileBounds = false;
+    bool drawPlantBounds = false;
+    char buffer[16];
+
+    if (drawPlantBounds) {
+        for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
+            Planter *planter = &garden->planters[i];
+
+            if (planter->exists) {
+                for (int j = 0; j < planter->plantGrid.tileCount; j++) {
+                    if (garden->plants.exists[garden_getPlantId(i, j)]) {
+
+                        Vector2 plantCoords
+                            = grid_getCoordsFromTileIndex(planter->plantGrid.cols, j);
+
+                        Vector2 planterWorldPos = getPlanterWorldPos(garden, planter->coords);
+
+                        planterWorldPos.y -= planterDefinitions[planter->type].plantBasePosY;
+
+                        IsoTransform localTransform = {
+                            planterWorldPos,
+                            SCENE_TRANSFORM.rotation,
+                            SCENE_TRANSFORM.scale,
+                        };
+
+                        IsoRec isoRec = grid_toIsoRec(&localTransform,
+                            plantCoords,
+                            (Vector2){1, 1},
+                            planter->plantGrid.tileWidth,
+                            planter->plantGrid.tileHeight);
+
+                        drawIsoRectangleLines(garden, isoRec, 1, RED);
+                    }
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < GARDEN_TILE_COUNT; i++) {
+        IsoRec currentTile = garden_getTileIsoVertices(garden, i);
+
+        if (drawTileBounds) {
+            drawIsoRectangleLines(garden, currentTile, 1, (Color){255, 109, 194, 50});
+        }
+
+        if (showZIndexOnTile) {
+            Vector2 tileCoords = grid_getCoordsFromTileIndex(GARDEN_COLS, i);
+
+            int zIndex = grid_getZIndex(
+                SCENE_TRANSFORM.rotation, tileCoords.x, tileCoords.y, GARDEN_COLS, GARDEN_ROWS);
+
+            snprintf(buffer, 8, "%d", zIndex);
+
+            DrawText(buffer,
+                currentTile.right.x - ((currentTile.right.x - currentTile.left.x) / 2),
+                currentTile.bottom.y - 20,
+                12,
+                WHITE);
+        }
+
+        if (showZIndexOnEntity) {
+            Planter *planter = &garden->planters[i];
+
+            if (planter->exists) {
+                int planterTileIndex = grid_getTileIndexFromCoords(
+                    GARDEN_COLS, GARDEN_ROWS, planter->coords.x, planter->coords.y);
+
+                int zIndex = getPlanterZIndex(garden, planterTileIndex);
+
+                IsoRec planterTile = garden_getTileIsoVertices(garden, planterTileIndex);
+
+                snprintf(buffer, 8, "%d", zIndex);
+
+                DrawText(buffer,
+                    planterTile.bottom.x,
+                    planterTile.bottom.y - (int)(TILE_HEIGHT / 2),
+                    12,
+                    PURPLE);
+
+                for (int j = 0; j < planter->plantGrid.tileCount; j++) {
+                    if (garden->plants.exists[garden_getPlantId(i, j)]) {
+                        Vector2 plantWorldPos = planter_getPlantDrawOrigin(planter, j);
+
+                        int zIndex = getPlantZIndex(SCENE_TRANSFORM.rotation, planter, j);
+
+                        snprintf(buffer, 8, "%d", zIndex);
+
+                        DrawText(buffer, plantWorldPos.x, plantWorldPos.y, 12, PURPLE);
+                    }
+                }
+            }
+        }
+
+        if (showPlanterIndexOnTile) {
+            int planterIndex = garden->tiles[i].planterIndex;
+
+            if (planterIndex != -1) {
+
+                snprintf(buffer, 8, "%d", planterIndex);
+
+                DrawText(buffer,
+                    currentTile.right.x - ((currentTile.right.x - currentTile.left.x) / 2),
+                    currentTile.bottom.y - ((currentTile.bottom.y - currentTile.top.y) / 2),
+                    20,
+                    WHITE);
+            }
+        }
+
+        if (showPlantIndexOnPlanter) {
+            int planterIndex = i;
+            Planter *planter = &garden->planters[planterIndex];
+
+            if (planter->exists) {
+
+                for (int plantIndex = 0; plantIndex < planter->plantGrid.tileCount; plantIndex++) {
+                    Vector2 plantDrawOrigin = planter_getPlantDrawOrigin(planter, plantIndex);
+                    snprintf(buffer, 11, "%d", plantIndex);
+                    DrawText(buffer, plantDrawOrigin.x, plantDrawOrigin.y, 20, WHITE);
+                }
+            }
+        }
+    }
+
+    snprintf(buffer, 8, "GR %d", SCENE_TRANSFORM.rotation);
+    DrawText(buffer, 600, 0, 20, WHITE);
+    snprintf(buffer, 8, "SR %d", garden->selectionRotation);
+    DrawText(buffer, 600, 30, 20, WHITE);
+
+    // DrawCircle(garden->lightSourcePos.x,
+    //     garden->lightSourcePos.y,
+    //     LIGHT_SOURCE_RADIUS * SCENE_TRANSFORM.scale,
+    //     YELLOW);
+}
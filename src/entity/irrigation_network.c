@@ -0,0 +1,164 @@
+#include "irrigation_network.h"
+#include <assert.h>
+#include <string.h>
+
+void irrigationNetwork_init(IrrigationNetwork *network, int cols, int rows) {
+    assert(cols > 0 && cols <= GARDEN_MAX_COLS);
+    assert(rows > 0 && rows <= GARDEN_MAX_ROWS);
+
+    network->cols = cols;
+    network->rows = rows;
+    network->dirty = false;
+
+    memset(network->pieces, 0, sizeof(network->pieces));
+    memset(network->flow, 0, sizeof(network->flow));
+}
+
+static bool isInNetwork(const IrrigationNetwork *network, int x, int y) {
+    return x >= 0 && x < network->cols && y >= 0 && y < network->rows;
+}
+
+/// Lays `piece` on the tile, IRRIGATION_PIECE_NONE takes the one there away. Out of the garden
+/// does nothing
+void irrigationNetwork_setPiece(IrrigationNetwork *network, int x, int y, IrrigationPiece piece) {
+    if (!isInNetwork(network, x, y) || network->pieces[y][x] == piece) {
+        return;
+    }
+
+    network->pieces[y][x] = piece;
+    network->dirty = true;
+}
+
+IrrigationPiece irrigationNetwork_getPiece(const IrrigationNetwork *network, int x, int y) {
+    if (!isInNetwork(network, x, y)) {
+        return IRRIGATION_PIECE_NONE;
+    }
+
+    return network->pieces[y][x];
+}
+
+int irrigationNetwork_getFlow(const IrrigationNetwork *network, int x, int y) {
+    if (!isInNetwork(network, x, y)) {
+        return 0;
+    }
+
+    return network->flow[y][x];
+}
+
+static const int neighborOffsets[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+/// Gives each piece the number of its network in `networkOf` (-1 for tiles without one), and
+/// each network the water of its taps in `supply`
+static void labelNetworks(const IrrigationNetwork *network,
+    int networkOf[GARDEN_MAX_ROWS][GARDEN_MAX_COLS],
+    int *supply) {
+    int stack[GARDEN_MAX_TILES];
+    int networksCount = 0;
+
+    for (int y = 0; y < network->rows; y++) {
+        for (int x = 0; x < network->cols; x++) {
+            networkOf[y][x] = -1;
+        }
+    }
+
+    for (int y = 0; y < network->rows; y++) {
+        for (int x = 0; x < network->cols; x++) {
+            if (network->pieces[y][x] == IRRIGATION_PIECE_NONE || networkOf[y][x] != -1) {
+                continue;
+            }
+
+            int label = networksCount++;
+            int stackCount = 0;
+
+            supply[label] = 0;
+            networkOf[y][x] = label;
+            stack[stackCount++] = y * network->cols + x;
+
+            while (stackCount > 0) {
+                int tile = stack[--stackCount];
+                int tileX = tile % network->cols;
+                int tileY = tile / network->cols;
+
+                if (network->pieces[tileY][tileX] == IRRIGATION_PIECE_TAP) {
+                    supply[label] += IRRIGATION_TAP_FLOW;
+                }
+
+                for (int i = 0; i < 4; i++) {
+                    int nx = tileX + neighborOffsets[i][0];
+                    int ny = tileY + neighborOffsets[i][1];
+
+                    if (!isInNetwork(network, nx, ny)
+                        || network->pieces[ny][nx] == IRRIGATION_PIECE_NONE
+                        || networkOf[ny][nx] != -1) {
+                        continue;
+                    }
+
+                    networkOf[ny][nx] = label;
+                    stack[stackCount++] = ny * network->cols + nx;
+                }
+            }
+        }
+    }
+}
+
+/// Works out the flow of every dripper. The pressure drops with the pieces between a dripper and
+/// its closest tap, and when the drippers of a network want more than its taps give, the ones
+/// closer to a tap take theirs first. Only integer math and a fixed order, so the same pieces
+/// always give the same flows
+void irrigationNetwork_solve(IrrigationNetwork *network) {
+    int networkOf[GARDEN_MAX_ROWS][GARDEN_MAX_COLS];
+    int supply[GARDEN_MAX_TILES];
+
+    labelNetworks(network, networkOf, supply);
+
+    // breadth first from every tap at once: the queue ends up sorted by distance to a tap
+    int queue[GARDEN_MAX_TILES];
+    int distance[GARDEN_MAX_ROWS][GARDEN_MAX_COLS];
+    int head = 0;
+    int tail = 0;
+
+    for (int y = 0; y < network->rows; y++) {
+        for (int x = 0; x < network->cols; x++) {
+            distance[y][x] = -1;
+
+            if (network->pieces[y][x] == IRRIGATION_PIECE_TAP) {
+                distance[y][x] = 0;
+                queue[tail++] = y * network->cols + x;
+            }
+        }
+    }
+
+    memset(network->flow, 0, sizeof(network->flow));
+
+    while (head < tail) {
+        int tile = queue[head++];
+        int x = tile % network->cols;
+        int y = tile / network->cols;
+
+        if (network->pieces[y][x] == IRRIGATION_PIECE_DRIPPER) {
+            int *left = &supply[networkOf[y][x]];
+            int wanted = IRRIGATION_DRIPPER_FLOW - distance[y][x] / IRRIGATION_PRESSURE_DROP_PIECES;
+            int flow = wanted < *left ? wanted : *left;
+
+            if (flow > 0) {
+                network->flow[y][x] = flow;
+                *left -= flow;
+            }
+        }
+
+        for (int i = 0; i < 4; i++) {
+            int nx = x + neighborOffsets[i][0];
+            int ny = y + neighborOffsets[i][1];
+
+            if (!isInNetwork(network, nx, ny) || network->pieces[ny][nx] == IRRIGATION_PIECE_NONE
+                || distance[ny][nx] != -1) {
+                continue;
+            }
+
+            distance[ny][nx] = distance[y][x] + 1;
+            queue[tail++] = ny * network->cols + nx;
+        }
+    }
+
+    network->dirty = false;
+}
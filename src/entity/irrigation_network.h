@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../game/constants.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Irrigation: taps, pipes and drippers laid on the tiles of the garden. Pieces on tiles next to
+// each other are connected, and the water of the taps of a network goes to its drippers, the ones
+// closest to a tap first. Flows only change with the pieces, so they are worked out once when one
+// is laid or taken away (see irrigationNetwork_solve) and the plants take the flow of their
+// planter as a constant of their update, like the temperature
+
+typedef enum {
+    IRRIGATION_PIECE_NONE,
+    IRRIGATION_PIECE_PIPE,
+    /// waters the planter on its tile
+    IRRIGATION_PIECE_DRIPPER,
+    /// where the water comes from
+    IRRIGATION_PIECE_TAP,
+    IRRIGATION_PIECE_COUNT,
+} IrrigationPiece;
+
+// flows are in half points a second of hydration of the soil, so a tick of them is a whole
+// amount of PlantStat units (see PlantDefinition.secondsPerTick)
+/// water a tap gives to its network
+#define IRRIGATION_TAP_FLOW 8
+/// most a dripper gives, right next to a tap
+#define IRRIGATION_DRIPPER_FLOW 2
+/// pieces between a tap and a dripper for the pressure to drop half a point a second
+#define IRRIGATION_PRESSURE_DROP_PIECES 8
+
+typedef struct {
+    int cols;
+    int rows;
+    /// IrrigationPiece of tile (x, y) at [y][x]
+    uint8_t pieces[GARDEN_MAX_ROWS][GARDEN_MAX_COLS];
+    /// flow of the dripper of each tile as of the last solve, 0 for the rest
+    uint8_t flow[GARDEN_MAX_ROWS][GARDEN_MAX_COLS];
+    /// a piece was laid or taken away since the last solve
+    bool dirty;
+} IrrigationNetwork;
+
+void irrigationNetwork_init(IrrigationNetwork *network, int cols, int rows);
+void irrigationNetwork_setPiece(IrrigationNetwork *network, int x, int y, IrrigationPiece piece);
+IrrigationPiece irrigationNetwork_getPiece(const IrrigationNetwork *network, int x, int y);
+int irrigationNetwork_getFlow(const IrrigationNetwork *network, int x, int y);
+void irrigationNetwork_solve(IrrigationNetwork *network);
@@ -0,0 +1,76 @@
+#include "light_integral.h"
+#include <assert.h>
+#include <string.h>
+
+void lightIntegral_init(LightIntegral *integral, int cols, int rows, int dayOfYear) {
+    assert(cols > 0 && cols <= GARDEN_MAX_COLS);
+    assert(rows > 0 && rows <= GARDEN_MAX_ROWS);
+
+    integral->cols = cols;
+    integral->rows = rows;
+    integral->day = dayOfYear;
+    integral->lastDay = 0;
+    integral->daysCount = 0;
+
+    memset(integral->today, 0, sizeof(integral->today));
+    memset(integral->days, 0, sizeof(integral->days));
+    memset(integral->daysSum, 0, sizeof(integral->daysSum));
+}
+
+/// Ends today if `dayOfYear` is another day: it goes into the average, in place of the oldest one,
+/// and the new day starts in the dark
+void lightIntegral_setDay(LightIntegral *integral, int dayOfYear) {
+    if (integral->day == dayOfYear) {
+        return;
+    }
+
+    float(*oldest)[GARDEN_MAX_COLS] = integral->days[integral->lastDay];
+
+    for (int y = 0; y < integral->rows; y++) {
+        for (int x = 0; x < integral->cols; x++) {
+            oldest[y][x] = integral->today[y][x];
+            integral->today[y][x] = 0;
+
+            // added up again, in the same order every time: taking the oldest day off and adding
+            // today would leave the rounding of every day that was ever in the sum
+            float sum = 0;
+
+            for (int day = 0; day < LIGHT_INTEGRAL_DAYS; day++) {
+                sum += integral->days[day][y][x];
+            }
+
+            integral->daysSum[y][x] = sum;
+        }
+    }
+
+    integral->lastDay = (integral->lastDay + 1) % LIGHT_INTEGRAL_DAYS;
+
+    if (integral->daysCount < LIGHT_INTEGRAL_DAYS) {
+        integral->daysCount++;
+    }
+
+    integral->day = dayOfYear;
+}
+
+void lightIntegral_add(LightIntegral *integral, int x, int y, float sunHours) {
+    assert(x >= 0 && x < integral->cols && y >= 0 && y < integral->rows);
+
+    integral->today[y][x] += sunHours;
+}
+
+float lightIntegral_getToday(const LightIntegral *integral, int x, int y) {
+    assert(x >= 0 && x < integral->cols && y >= 0 && y < integral->rows);
+
+    return integral->today[y][x];
+}
+
+/// Hours of full sun a day over the last days. Before the first day ends, the ones of today
+float lightIntegral_getAverage(const LightIntegral *integral, int x, int y) {
+    assert(x >= 0 && x < integral->cols && y >= 0 && y < integral->rows);
+
+    if (integral->daysCount == 0) {
+        return integral->today[y][x];
+    }
+
+    return integral->daysSum[y][x] / integral->daysCount;
+}
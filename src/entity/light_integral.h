@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../game/constants.h"
+
+// Light the tiles got: how much today, and the average of the last days. The light is in hours of
+// full sun, so a tile in the open gets about 6 of them on a clear day at the equinoxes. Adding to
+// a tile is a sum, and the average is kept as the sum of the last days. The sum is made again from
+// the days when one ends, once a game day, so it is always the sum of the days that are in it
+
+/// days of the average
+#define LIGHT_INTEGRAL_DAYS 7
+
+typedef struct {
+    int cols;
+    int rows;
+    /// day of the year `today` is of
+    int day;
+    /// tile (x, y) is at [y][x], like the ones below
+    float today[GARDEN_MAX_ROWS][GARDEN_MAX_COLS];
+    /// light of the last days that ended, in a ring: `lastDay` is the next to write
+    float days[LIGHT_INTEGRAL_DAYS][GARDEN_MAX_ROWS][GARDEN_MAX_COLS];
+    int lastDay;
+    /// days in `days`, up to LIGHT_INTEGRAL_DAYS
+    int daysCount;
+    /// sum of `days` by tile
+    float daysSum[GARDEN_MAX_ROWS][GARDEN_MAX_COLS];
+} LightIntegral;
+
+void lightIntegral_init(LightIntegral *integral, int cols, int rows, int dayOfYear);
+void lightIntegral_setDay(LightIntegral *integral, int dayOfYear);
+void lightIntegral_add(LightIntegral *integral, int x, int y, float sunHours);
+float lightIntegral_getToday(const LightIntegral *integral, int x, int y);
+float lightIntegral_getAverage(const LightIntegral *integral, int x, int y);
@@ -1,15 +1,13 @@
 
 #include "plant.h"
-#include "../core/asset_manager.h"
 #include "../game/constants.h"
-#include "../utils/utils.h"
-#include "raylib.h"
+#include "../game/gameplay.h"
+#include "plant_genome.h"
 #include <assert.h>
 #include <math.h>
 #include <stdlib.h>
 
 #define PLANT_STATE_COUNT 6
-#define PLANT_TICKS_PER_SECOND 1.0f
 
 const PlantDefinition plantDefinitions[PLANT_TYPE_COUNT] = {
     [PLANT_TYPE_CRASSULA_OVATA] = {
@@ -19,6 +17,7 @@ const PlantDefinition plantDefinitions[PLANT_TYPE_COUNT] = {
         .spriteDimensions = { 32, 32 },
         .optimalWaterLevel = PLANT_WATER_LEVEL_DRY,
         .optimalNutrientsLevel = PLANT_NUTRIENT_LEVEL_3,
+        .secondsPerTick = 2.0f,
         .overWateredResiliece = false,
         .underWateredResiliece = true,
         .overNutritionResiliece = false,
@@ -32,6 +31,7 @@ const PlantDefinition plantDefinitions[PLANT_TYPE_COUNT] = {
         .underWateredResiliece = true,
         .optimalWaterLevel = PLANT_WATER_LEVEL_MOIST,
         .optimalNutrientsLevel = PLANT_NUTRIENT_LEVEL_3,
+        .secondsPerTick = 1.0f,
         .overWateredResiliece = false,
         .underWateredResiliece = false,
         .overNutritionResiliece = false,
@@ -39,6 +39,18 @@ const PlantDefinition plantDefinitions[PLANT_TYPE_COUNT] = {
     },
 };
 
+static PlantStat clampStat(long long value) {
+    if (value < 0) {
+        return 0;
+    }
+
+    if (value > PLANT_STAT_MAX) {
+        return PLANT_STAT_MAX;
+    }
+
+    return value;
+}
+
 int minmax(int min, int max) {
     if (max < min) {
         return max;
@@ -48,216 +60,815 @@ int minmax(int min, int max) {
 }
 
 int plant_getMaxValueForLevel(int level) {
-    int pointsPerLevel = 100.0f / PLANT_STATUS_LEVEL_COUNT;
-
-    // level at 1 point to be next level
-    return (pointsPerLevel * (level + 1)) - 1;
+    return PLANT_MAX_POINTS_FOR_LEVEL(level);
 }
 
-int plant_getStatLevel(float statValue) {
-    float x = 100.0f / PLANT_STATUS_LEVEL_COUNT;
+/// Same as clamping the points to [0, 100] and dividing them by 20. Takes values out of the
+/// range too, for the stats before they are clamped
+int plant_getStatLevel(int statValue) {
+    const int statPerLevel = PLANT_STAT_MAX / PLANT_STATUS_LEVEL_COUNT;
 
-    // int level = ((statValue + x - 1) / x) - 1;
-    int level = utils_clampf(0, 100, statValue) / x;
-    // int rest = (int)statValue % (int)x;
-    // if (rest > 0) {
-    //     level++;
-    // }
-
-    return level;
+    return clampStat(statValue) / statPerLevel;
 }
 
 void plant_init(Plant *p, enum PlantType type) {
+    plant_initWithGenome(p, type, 0);
+}
+
+void plant_initWithGenome(Plant *p, enum PlantType type, PlantGenome genome) {
     p->type = type;
     p->exists = true;
+    p->genome = genome;
+    p->traits = plantGenome_express(genome, &plantDefinitions[type]);
+    p->infected = false;
+    p->temperature = PLANT_TEMPERATURE_MILD;
+    p->light = PLANT_LIGHT_FULL;
+    p->irrigation = 0;
     p->mediumHydration = 0;
     p->mediumNutrition = 0;
-    p->hydration = plant_getMaxValueForLevel(2);
-    p->nutrition = plant_getMaxValueForLevel(2);
-    p->health = 80;
-    p->timeSinceLastTick = 0;
+    p->hydration = PLANT_STAT(plant_getMaxValueForLevel(2));
+    p->nutrition = PLANT_STAT(plant_getMaxValueForLevel(2));
+    p->health = PLANT_STAT(80);
+    p->biomass = 0;
     p->ticksCount = 0;
 }
 
 void plant_irrigate(Plant *p) {
-    p->mediumHydration += 10;
+    p->mediumHydration = clampStat(p->mediumHydration + PLANT_STAT(10));
+}
+
+void plant_feed(Plant *p) {
+    p->mediumNutrition = clampStat(p->mediumNutrition + PLANT_STAT(10));
+}
 
-    if (p->mediumHydration >= 100) {
-        p->mediumHydration = 100;
+/// Cuts a growth stage worth of biomass
+void plant_prune(Plant *p) {
+    p->biomass = p->biomass > PLANT_BIOMASS_PER_STAGE ? p->biomass - PLANT_BIOMASS_PER_STAGE : 0;
+}
+
+PlantTemperature plant_getTemperature(float degrees) {
+    if (degrees < PLANT_TEMPERATURE_COLD_BELOW) {
+        return PLANT_TEMPERATURE_COLD;
+    }
+
+    if (degrees > PLANT_TEMPERATURE_HOT_ABOVE) {
+        return PLANT_TEMPERATURE_HOT;
     }
+
+    return PLANT_TEMPERATURE_MILD;
 }
 
-void plant_feed(Plant *p) {
-    p->mediumNutrition += 10;
+/// `sunHours` a day
+PlantLight plant_getLight(float sunHours) {
+    if (sunHours < PLANT_LIGHT_SHADE_BELOW) {
+        return PLANT_LIGHT_SHADE;
+    }
+
+    if (sunHours < PLANT_LIGHT_PARTIAL_BELOW) {
+        return PLANT_LIGHT_PARTIAL;
+    }
+
+    return PLANT_LIGHT_FULL;
+}
+
+PlantGrowthStage plant_getGrowthStage(int biomass) {
+    int stage = biomass / PLANT_BIOMASS_PER_STAGE;
+
+    return stage < PLANT_GROWTH_STAGE_COUNT ? stage : PLANT_GROWTH_STAGE_OVERGROWN;
+}
+
+const char *plant_getGrowthStageName(PlantGrowthStage stage) {
+    switch (stage) {
+    case PLANT_GROWTH_STAGE_SPROUT:
+        return "Sprout";
+    case PLANT_GROWTH_STAGE_YOUNG:
+        return "Young";
+    case PLANT_GROWTH_STAGE_GROWN:
+        return "Grown";
+    case PLANT_GROWTH_STAGE_OVERGROWN:
+        return "Overgrown";
+    default:
+        assert(false);
+        return "";
+    }
+}
 
-    if (p->mediumNutrition >= 100) {
-        p->mediumNutrition = 100;
+static int clampBiomass(long long value) {
+    if (value < 0) {
+        return 0;
     }
+
+    if (value > PLANT_BIOMASS_MAX) {
+        return PLANT_BIOMASS_MAX;
+    }
+
+    return value;
 }
 
 float exponential(float initial, float rate, float x) {
     return initial * pow((1 + rate), x);
 }
 
-void plant_update(Plant *plant, float deltaTime) {
-    deltaTime *= PLANT_TICKS_PER_SECOND;
+/// `rate` (stat per second) for `deltaTime` seconds, both in PLANT_STAT_ONE units
+static int scaleByTime(int rate, int deltaTime) {
+    return rate * deltaTime / PLANT_STAT_ONE;
+}
 
-    float healthChange = 0;
+/// Rates are in PLANT_STAT_ONE units per second. All of them are multiples of half a point, so
+/// scaling them by a tick (a multiple of 1/128 seconds) doesn't lose anything. What depends on
+/// the species comes from the traits of the plant
+static PlantChanges getChanges(const Plant *plant, int deltaTime) {
+    PlantChanges changes = {0};
+    int healthChange = 0;
 
     const int hydrationLevel = plant_getStatLevel(plant->hydration);
-    const int optimalHydrationLevel = 2;
+    const int optimalHydrationLevel = PLANT_OPTIMAL_HYDRATION_LEVEL;
 
     const int hydrationLevelDistanceFromOptimal = abs(optimalHydrationLevel - hydrationLevel);
 
     // Health change based on hydration
     switch (hydrationLevelDistanceFromOptimal) {
     case 0:
-        healthChange += 1;
+        healthChange += PLANT_STAT(1);
         break;
     case 2:
-        healthChange -= 2;
+        healthChange -= PLANT_STAT(2);
+
+        if (hydrationLevel < optimalHydrationLevel) {
+            healthChange += plant->traits.droughtResilience * PLANT_STAT_ONE / 2;
+        }
         break;
     }
 
     const int nutritionLevel = plant_getStatLevel(plant->nutrition);
-    const int optimalNutritionLevel = 2;
+    const int optimalNutritionLevel = plant->traits.optimalNutritionLevel;
 
     int nutritionLevelDistanceFromOptimal = abs(optimalNutritionLevel - nutritionLevel);
 
     // Health change based on hydration
     switch (nutritionLevelDistanceFromOptimal) {
     case 0:
-        healthChange += 1;
+        healthChange += PLANT_STAT(1);
         break;
     case 2:
-        healthChange -= 2;
+        healthChange -= PLANT_STAT(2);
         break;
     }
 
-    plant->health += healthChange * deltaTime;
+    if (plant->infected) {
+        healthChange -= PLANT_STAT(1);
+    }
 
-    const PlantDefinition *props = &plantDefinitions[plant->type];
+    changes.health = scaleByTime(healthChange, deltaTime);
 
     // Hydration change based on hydration medium
     const int mediumHydrationLevel = plant_getStatLevel(plant->mediumHydration);
-    const int mediumWaterLevelDistanceFromOptimal = props->optimalWaterLevel - mediumHydrationLevel;
-    float hydrationChange = 0;
+    const int optimalWaterLevel = plant->traits.optimalWaterLevel;
+    const int mediumWaterLevelDistanceFromOptimal = optimalWaterLevel - mediumHydrationLevel;
+    int hydrationChange = 0;
 
     if (mediumWaterLevelDistanceFromOptimal == 0) {
         // in favorite medium level
 
         // if it likes saturated medium it can never be over watered
-        if (props->optimalWaterLevel == 4) {
-            hydrationChange = 1;
+        if (optimalWaterLevel == 4) {
+            hydrationChange = PLANT_STAT(1);
 
             if (nutritionLevel > 2) {
-                plant->hydration = plant_getMaxValueForLevel(2);
+                changes.hydrationReset = true;
             }
         } else if (plant->hydration < plant->mediumHydration) {
-            hydrationChange = 2;
+            hydrationChange = PLANT_STAT(2);
         } else {
-            hydrationChange = -2;
+            hydrationChange = -PLANT_STAT(2);
         }
     } else if (mediumHydrationLevel == 0 && plant->hydration < plant->mediumHydration) {
         // when hydration in plant and medium are 0, and the medium is irrigated, hydration
         // should go up
-        hydrationChange += 1;
+        hydrationChange += PLANT_STAT(1);
     } else {
-        hydrationChange = -mediumWaterLevelDistanceFromOptimal;
+        hydrationChange = -mediumWaterLevelDistanceFromOptimal * PLANT_STAT_ONE;
     }
 
-    plant->hydration += hydrationChange * deltaTime;
+    changes.hydration = scaleByTime(hydrationChange, deltaTime);
 
     // Medium hydration change based on own level and plant hydration change
-    float hydrationLoss = utils_absf(hydrationChange) * 0.5f;
+    int hydrationLoss = abs(hydrationChange) / 2;
     // Drainage for higher hydration levels
     if (mediumHydrationLevel > 2) {
-        hydrationLoss += (mediumHydrationLevel - 2);
+        hydrationLoss += (mediumHydrationLevel - 2) * PLANT_STAT_ONE;
     }
 
-    plant->mediumHydration -= hydrationLoss * deltaTime;
+    // Evaporation
+    if (plant->temperature == PLANT_TEMPERATURE_HOT) {
+        hydrationLoss += PLANT_STAT(1);
+    }
+
+    // Drippers
+    int irrigation = plant->irrigation * PLANT_STAT_ONE / 2;
+
+    changes.mediumHydration = scaleByTime(irrigation - hydrationLoss, deltaTime);
 
     // Hydration change based on hydration medium
-    float nutritionChange = 0;
+    int nutritionChange = 0;
     const int mediumNutritionLevel = plant_getStatLevel(plant->mediumNutrition);
-    const int healthLevel = plant_getStatLevel(plant->health);
+    // the health after its change of this update
+    const int healthLevel = plant_getStatLevel(plant->health + changes.health);
 
     if (plant->mediumNutrition == 0) {
-        nutritionChange = -healthLevel * 0.5f;
+        nutritionChange = -healthLevel * PLANT_STAT_ONE / 2;
     } else {
-        // less healthy => less nutrients consumed
-        float mediumNutrientLevelFactor = (mediumNutritionLevel) * 0.5f;
+        // less healthy => less nutrients consumed, in whole points
+        int mediumNutrientLevelFactor = mediumNutritionLevel / 2;
+
+        int healthLevelFactor = healthLevel / 2 + 1;
+
+        int feeding = healthLevelFactor + mediumNutrientLevelFactor;
+        // can't take more than the whole points left in the medium
+        nutritionChange = minmax(feeding, plant->mediumNutrition / PLANT_STAT_ONE) * PLANT_STAT_ONE;
+    }
+
+    changes.nutrition = scaleByTime(nutritionChange, deltaTime);
+    changes.mediumNutrition = -scaleByTime(abs(nutritionChange) / 2, deltaTime);
+
+    // Growth based on health, slower out of the optimal hydration. Dying plants wilt. Biomass
+    // doesn't change any other rule, so it is just one more stat that moves the same way all the
+    // segment
+    int growth = 0;
+
+    if (healthLevel >= PLANT_HEALTH_LEVEL_THRIVING) {
+        growth = PLANT_STAT(1);
+    } else if (healthLevel == PLANT_HEALTH_LEVEL_HEALTHY) {
+        growth = PLANT_STAT_ONE / 2;
+    } else if (healthLevel <= PLANT_HEALTH_LEVEL_DYING) {
+        growth = -PLANT_STAT_ONE / 2;
+    }
+
+    if (growth > 0 && hydrationLevelDistanceFromOptimal != 0) {
+        growth -= PLANT_STAT_ONE / 2;
+    }
+
+    if (growth > 0 && plant->light == PLANT_LIGHT_PARTIAL) {
+        growth -= PLANT_STAT_ONE / 2;
+    }
+
+    if (growth > 0
+        && (plant->temperature == PLANT_TEMPERATURE_COLD || plant->light == PLANT_LIGHT_SHADE)) {
+        growth = 0;
+    }
+
+    changes.biomass = scaleByTime(growth, deltaTime);
+
+    return changes;
+}
+
+/// `deltaTime` in PLANT_STAT_ONE units
+static void update(Plant *plant, int deltaTime) {
+    PlantChanges changes = getChanges(plant, deltaTime);
+
+    if (changes.hydrationReset) {
+        plant->hydration = PLANT_HYDRATION_RESET;
+    }
+
+    plant->health = clampStat(plant->health + changes.health);
+    plant->hydration = clampStat(plant->hydration + changes.hydration);
+    plant->nutrition = clampStat(plant->nutrition + changes.nutrition);
+    plant->mediumHydration = clampStat(plant->mediumHydration + changes.mediumHydration);
+    plant->mediumNutrition = clampStat(plant->mediumNutrition + changes.mediumNutrition);
+    plant->biomass = clampBiomass(plant->biomass + changes.biomass);
+}
+
+/// Updates the plant for `deltaTime` seconds, which must be a multiple of 1/256
+void plant_update(Plant *plant, float deltaTime) {
+    update(plant, deltaTime * PLANT_STAT_ONE);
+}
+
+static void tick(Plant *plant, const PlantDefinition *props) {
+    update(plant, props->secondsPerTick * PLANT_STAT_ONE);
+    plant->ticksCount++;
+}
+
+/// Updates the plant by one fixed step of its species
+void plant_tick(Plant *plant) {
+    tick(plant, &plantDefinitions[plant->type]);
+}
+
+// Catch up: while the levels (and the other conditions the rules look at) don't change, every tick
+// adds the same changes, so `n` ticks are `stat + n * change` clamped. A segment ends where any of
+// those conditions changes, and the ticks are jumped from segment to segment. Stats move in one
+// direction inside a segment, so a condition that holds at some tick held at all the ticks before
+// it, and the end of a segment can be searched for.
+// Stats are integers, so the jump is exactly the same as adding the change n times
+
+/// Stat after `ticks` ticks of the same change, before being clamped
+static long long getUnclampedStatAfterTicks(PlantStat value, int change, long ticks) {
+    return value + (long long)ticks * change;
+}
+
+/// Stat after `ticks` ticks of the same change, as repeated clamped updates would leave it
+static PlantStat getStatAfterTicks(PlantStat value, int change, long ticks) {
+    return clampStat(getUnclampedStatAfterTicks(value, change, ticks));
+}
+
+/// `mediumNutrition` matters by its level, by being 0, and by its whole points when the plant
+/// can take them all in a tick, which is only possible at the lowest level
+static int getMediumNutritionKey(PlantStat mediumNutrition) {
+    if (mediumNutrition == 0) {
+        return -1;
+    }
+
+    if (plant_getStatLevel(mediumNutrition) == 0) {
+        return mediumNutrition / PLANT_STAT_ONE;
+    }
+
+    return 100 + plant_getStatLevel(mediumNutrition);
+}
+
+static bool isInStatRange(long long value) {
+    return value >= 0 && value <= PLANT_STAT_MAX;
+}
+
+/// Whether the `ticks`-th tick from `plant` takes the same `changes` as the first one
+static bool isSameSegment(const Plant *plant, const PlantChanges *changes, long ticks) {
+    PlantStat hydration = getStatAfterTicks(plant->hydration, changes->hydration, ticks);
+    PlantStat mediumHydration
+        = getStatAfterTicks(plant->mediumHydration, changes->mediumHydration, ticks);
+    PlantStat nutrition = getStatAfterTicks(plant->nutrition, changes->nutrition, ticks);
+    PlantStat mediumNutrition
+        = getStatAfterTicks(plant->mediumNutrition, changes->mediumNutrition, ticks);
+    // the rules look at the health after the change of the tick
+    PlantStat health = getStatAfterTicks(plant->health, changes->health, ticks + 1);
+
+    if (plant_getStatLevel(hydration) != plant_getStatLevel(plant->hydration)
+        || plant_getStatLevel(mediumHydration) != plant_getStatLevel(plant->mediumHydration)
+        || plant_getStatLevel(nutrition) != plant_getStatLevel(plant->nutrition)
+        || getMediumNutritionKey(mediumNutrition) != getMediumNutritionKey(plant->mediumNutrition)
+        || plant_getStatLevel(health) != plant_getStatLevel(plant->health + changes->health)) {
+        return false;
+    }
+
+    // hydration against medium hydration only moves in one direction while neither is clamped
+    bool hydrationStill = hydration == plant->hydration;
+    bool mediumHydrationStill = mediumHydration == plant->mediumHydration;
+
+    if (!hydrationStill
+        && !isInStatRange(
+            getUnclampedStatAfterTicks(plant->hydration, changes->hydration, ticks))) {
+        return false;
+    }
+
+    if (!mediumHydrationStill
+        && !isInStatRange(
+            getUnclampedStatAfterTicks(plant->mediumHydration, changes->mediumHydration, ticks))) {
+        return false;
+    }
+
+    return (hydration < mediumHydration) == (plant->hydration < plant->mediumHydration);
+}
+
+/// Ticks (at least 1, up to `maxTicks`) that take the same changes as the first one
+long plant_getSegmentTicks(const Plant *plant, const PlantChanges *changes, long maxTicks) {
+    if (changes->hydrationReset) {
+        return 1;
+    }
+
+    // usual when reading a plant that is behind
+    if (isSameSegment(plant, changes, maxTicks - 1)) {
+        return maxTicks;
+    }
+
+    // gallop to a tick out of the segment, then binary search the end between the last two steps
+    long inside = 1;
+    long outside = 2;
+
+    while (outside < maxTicks && isSameSegment(plant, changes, outside - 1)) {
+        inside = outside;
+        outside *= 2;
+    }
+
+    if (outside >= maxTicks) {
+        if (isSameSegment(plant, changes, maxTicks - 1)) {
+            return maxTicks;
+        }
+
+        outside = maxTicks;
+    }
+
+    // ticks [0, inside) are in the segment, tick `outside - 1` is not
+    while (outside - inside > 1) {
+        long middle = inside + (outside - inside) / 2;
+
+        if (isSameSegment(plant, changes, middle - 1)) {
+            inside = middle;
+        } else {
+            outside = middle;
+        }
+    }
+
+    return inside;
+}
+
+static PlantChanges getTickChanges(const Plant *plant, const PlantDefinition *props) {
+    return getChanges(plant, props->secondsPerTick * PLANT_STAT_ONE);
+}
+
+static void applyTickChanges(
+    Plant *plant, const PlantDefinition *props, const PlantChanges *changes, long ticks) {
+    if (changes->hydrationReset) {
+        assert(ticks == 1);
+        tick(plant, props);
+        return;
+    }
+
+    plant->health = getStatAfterTicks(plant->health, changes->health, ticks);
+    plant->hydration = getStatAfterTicks(plant->hydration, changes->hydration, ticks);
+    plant->mediumHydration
+        = getStatAfterTicks(plant->mediumHydration, changes->mediumHydration, ticks);
+    plant->nutrition = getStatAfterTicks(plant->nutrition, changes->nutrition, ticks);
+    plant->mediumNutrition
+        = getStatAfterTicks(plant->mediumNutrition, changes->mediumNutrition, ticks);
+    plant->biomass = clampBiomass(plant->biomass + (long long)ticks * changes->biomass);
+    plant->ticksCount += ticks;
+}
+
+/// Changes of a tick of the plant, the same for all the ticks of its current segment
+PlantChanges plant_getTickChanges(const Plant *plant) {
+    return getTickChanges(plant, &plantDefinitions[plant->type]);
+}
+
+/// Same as `ticks` plant_tick, as long as they don't go past the segment of `changes`
+void plant_applyTickChanges(Plant *plant, const PlantChanges *changes, long ticks) {
+    applyTickChanges(plant, &plantDefinitions[plant->type], changes, ticks);
+}
 
-        int healthLevelFactor = (healthLevel * 0.5f) + 1;
+// Cycles: some plants change segments every few ticks and keep doing it, i.e. a hydration that
+// chases the one of its soil under the rain or the drippers goes over and under it in turns. The
+// segments then come back in the same order: if the rules see at each tick of a cycle the same as
+// at the same tick of the first one, the cycle takes the same changes, and the stats move by the
+// same amounts. What the rules see are levels and a comparison of stats that move in a line from
+// a cycle to the next, so if they see the same at the first cycle and at the last one, they saw it
+// at all of them, and the end of the cycles can be searched for like the end of a segment. A stat
+// clamped in a cycle has to end it where it started, then it takes the same values every cycle
+
+/// longest cycle looked for
+#define PLANT_CYCLE_MAX_TICKS 16
+
+typedef enum {
+    CYCLE_STAT_MEDIUM_HYDRATION,
+    CYCLE_STAT_MEDIUM_NUTRITION,
+    CYCLE_STAT_HYDRATION,
+    CYCLE_STAT_NUTRITION,
+    CYCLE_STAT_HEALTH,
+    CYCLE_STAT_BIOMASS,
+    CYCLE_STAT_COUNT,
+} CycleStat;
+
+static void getCycleStats(const Plant *plant, long long stats[CYCLE_STAT_COUNT]) {
+    stats[CYCLE_STAT_MEDIUM_HYDRATION] = plant->mediumHydration;
+    stats[CYCLE_STAT_MEDIUM_NUTRITION] = plant->mediumNutrition;
+    stats[CYCLE_STAT_HYDRATION] = plant->hydration;
+    stats[CYCLE_STAT_NUTRITION] = plant->nutrition;
+    stats[CYCLE_STAT_HEALTH] = plant->health;
+    stats[CYCLE_STAT_BIOMASS] = plant->biomass;
+}
+
+static void getCycleChanges(const PlantChanges *changes, long long stats[CYCLE_STAT_COUNT]) {
+    stats[CYCLE_STAT_MEDIUM_HYDRATION] = changes->mediumHydration;
+    stats[CYCLE_STAT_MEDIUM_NUTRITION] = changes->mediumNutrition;
+    stats[CYCLE_STAT_HYDRATION] = changes->hydration;
+    stats[CYCLE_STAT_NUTRITION] = changes->nutrition;
+    stats[CYCLE_STAT_HEALTH] = changes->health;
+    stats[CYCLE_STAT_BIOMASS] = changes->biomass;
+}
+
+static long long getCycleStatMax(CycleStat stat) {
+    return stat == CYCLE_STAT_BIOMASS ? PLANT_BIOMASS_MAX : PLANT_STAT_MAX;
+}
+
+/// Stats of `plant` moved `cycles` times by `delta`
+static void getStatsAfterCycles(const Plant *plant,
+    const long long delta[CYCLE_STAT_COUNT],
+    long cycles,
+    long long stats[CYCLE_STAT_COUNT]) {
+    getCycleStats(plant, stats);
+
+    for (int i = 0; i < CYCLE_STAT_COUNT; i++) {
+        stats[i] += cycles * delta[i];
+    }
+}
+
+/// Whether the rules see the same in plants `a` and `b`, but the health
+static bool haveSameKeys(const Plant *a, const Plant *b) {
+    return plant_getStatLevel(a->hydration) == plant_getStatLevel(b->hydration)
+        && plant_getStatLevel(a->mediumHydration) == plant_getStatLevel(b->mediumHydration)
+        && plant_getStatLevel(a->nutrition) == plant_getStatLevel(b->nutrition)
+        && getMediumNutritionKey(a->mediumNutrition) == getMediumNutritionKey(b->mediumNutrition)
+        && (a->hydration < a->mediumHydration) == (b->hydration < b->mediumHydration);
+}
+
+/// Whether the `cycles`-th cycle from `states` (the ticks of the first cycle, and the plant after
+/// it) takes the same changes as the first one, tick by tick, and clamps nothing
+static bool isSameCycle(
+    const Plant *states, int period, const long long delta[CYCLE_STAT_COUNT], long cycles) {
+    for (int tick = 0; tick < period; tick++) {
+        long long at[CYCLE_STAT_COUNT];
+        long long next[CYCLE_STAT_COUNT];
+        getStatsAfterCycles(&states[tick], delta, cycles - 1, at);
+        getStatsAfterCycles(&states[tick + 1], delta, cycles - 1, next);
+
+        for (int i = 0; i < CYCLE_STAT_COUNT; i++) {
+            if (next[i] < 0 || next[i] > getCycleStatMax(i)) {
+                return false;
+            }
+        }
 
-        nutritionChange = healthLevelFactor + mediumNutrientLevelFactor;
-        nutritionChange = minmax(nutritionChange, plant->mediumNutrition);
+        Plant shifted = states[tick];
+        shifted.mediumHydration = at[CYCLE_STAT_MEDIUM_HYDRATION];
+        shifted.mediumNutrition = at[CYCLE_STAT_MEDIUM_NUTRITION];
+        shifted.hydration = at[CYCLE_STAT_HYDRATION];
+        shifted.nutrition = at[CYCLE_STAT_NUTRITION];
+
+        // the rules look at the health after the change of the tick
+        if (!haveSameKeys(&shifted, &states[tick])
+            || plant_getStatLevel(next[CYCLE_STAT_HEALTH])
+                   != plant_getStatLevel(states[tick + 1].health)) {
+            return false;
+        }
     }
 
-    plant->nutrition += nutritionChange * deltaTime;
-    plant->mediumNutrition -= utils_absf(nutritionChange) * 0.5f * deltaTime;
+    return true;
+}
+
+/// Sets in `clamped` the stats a tick of `changes` from `plant` takes out of range
+static void getClampedStats(const Plant *plant, const PlantChanges *changes, bool *clamped) {
+    long long stats[CYCLE_STAT_COUNT];
+    long long deltas[CYCLE_STAT_COUNT];
+    getCycleStats(plant, stats);
+    getCycleChanges(changes, deltas);
 
-    // clamp stat values
-    plant->health = utils_clampf(0, 100, plant->health);
-    plant->hydration = utils_clampf(0, 100, plant->hydration);
-    plant->nutrition = utils_clampf(0, 100, plant->nutrition);
-    plant->mediumHydration = utils_clampf(0, 100, plant->mediumHydration);
-    plant->mediumNutrition = utils_clampf(0, 100, plant->mediumNutrition);
+    for (int i = 0; i < CYCLE_STAT_COUNT; i++) {
+        long long value = stats[i] + deltas[i];
+
+        clamped[i] = clamped[i] || value < 0 || value > getCycleStatMax(i);
+    }
 }
 
-Rectangle plant_getSpriteSourceRect(enum PlantType type, int health) {
-    Vector2 dimensions = plantDefinitions[type].spriteDimensions;
-    // Position in the sprite atlas
-    Vector2 origin = {0, 0};
+/// Ticks the plant one tick at a time until the ticks since `plant` are a cycle, then jumps all the
+/// cycles that are the same, up to `maxTicks` in all. Returns the ticks it advanced the plant: the
+/// ones it looked at if they were no cycle, at least one
+static long advanceCycles(Plant *plant, const PlantDefinition *props, long maxTicks) {
+    Plant states[PLANT_CYCLE_MAX_TICKS + 1];
+    bool clamped[CYCLE_STAT_COUNT] = {0};
+    int period = 0;
+
+    states[0] = *plant;
 
-    for (int i = 0; i < type; i++) {
-        if (i == type) {
+    while (period < PLANT_CYCLE_MAX_TICKS && period < maxTicks) {
+        PlantChanges changes = getTickChanges(&states[period], props);
+        getClampedStats(&states[period], &changes, clamped);
+
+        states[period + 1] = states[period];
+        applyTickChanges(&states[period + 1], props, &changes, 1);
+        period++;
+
+        // the reset takes the hydration to a value, not by an amount
+        if (changes.hydrationReset) {
             break;
         }
 
-        Vector2 d = plantDefinitions[i].spriteDimensions;
+        long maxCycles = maxTicks / period;
+
+        if (maxCycles < 2 || !haveSameKeys(&states[0], &states[period])) {
+            continue;
+        }
 
-        origin.y += d.y;
+        long long start[CYCLE_STAT_COUNT];
+        long long delta[CYCLE_STAT_COUNT];
+        getCycleStats(&states[0], start);
+        getCycleStats(&states[period], delta);
+
+        bool clampedBack = true;
+
+        for (int i = 0; i < CYCLE_STAT_COUNT; i++) {
+            delta[i] -= start[i];
+            clampedBack = clampedBack && (!clamped[i] || delta[i] == 0);
+        }
+
+        if (!clampedBack || !isSameCycle(states, period, delta, 2)) {
+            continue;
+        }
+
+        // gallop to a number of cycles that isn't the same, then binary search the last one
+        long inside = 2;
+        long outside = 4;
+
+        while (outside <= maxCycles && isSameCycle(states, period, delta, outside)) {
+            inside = outside;
+            outside *= 2;
+        }
+
+        if (outside > maxCycles) {
+            if (isSameCycle(states, period, delta, maxCycles)) {
+                inside = maxCycles;
+            }
+
+            outside = maxCycles;
+        }
+
+        while (outside - inside > 1) {
+            long middle = inside + (outside - inside) / 2;
+
+            if (isSameCycle(states, period, delta, middle)) {
+                inside = middle;
+            } else {
+                outside = middle;
+            }
+        }
+
+        long long stats[CYCLE_STAT_COUNT];
+        getStatsAfterCycles(&states[0], delta, inside, stats);
+
+        *plant = states[0];
+        plant->mediumHydration = stats[CYCLE_STAT_MEDIUM_HYDRATION];
+        plant->mediumNutrition = stats[CYCLE_STAT_MEDIUM_NUTRITION];
+        plant->hydration = stats[CYCLE_STAT_HYDRATION];
+        plant->nutrition = stats[CYCLE_STAT_NUTRITION];
+        plant->health = stats[CYCLE_STAT_HEALTH];
+        plant->biomass = stats[CYCLE_STAT_BIOMASS];
+        plant->ticksCount += inside * period;
+
+        return inside * period;
     }
 
-    // use enum?
-    int spriteIndex;
-    if (health > 70) {
-        spriteIndex = 0;
-    } else if (health > 50) {
-        spriteIndex = 1;
-    } else if (health > 40) {
-        spriteIndex = 2;
-    } else if (health > 20) {
-        spriteIndex = 3;
-    } else if (health > 10) {
-        spriteIndex = 4;
-    } else {
-        spriteIndex = 5;
+    *plant = states[period];
+
+    return period;
+}
+
+/// plant_advanceTicks as if the species of the plant were `props`, to try definitions out (see
+/// tools/plant_sweep.c). `ticks` are of `props->secondsPerTick`. The traits are the ones of the
+/// plant, so they have to be expressed from `props` too (plantGenome_express). Short segments are
+/// looked at for cycles
+void plant_advanceTicksWithDefinition(Plant *plant, const PlantDefinition *props, long ticks) {
+    while (ticks > 0) {
+        PlantChanges changes = getTickChanges(plant, props);
+        long segmentTicks = plant_getSegmentTicks(plant, &changes, ticks);
+
+        if (segmentTicks < PLANT_CYCLE_MAX_TICKS && segmentTicks < ticks) {
+            ticks -= advanceCycles(plant, props, ticks);
+            continue;
+        }
+
+        applyTickChanges(plant, props, &changes, segmentTicks);
+        ticks -= segmentTicks;
     }
+}
 
-    origin.x = spriteIndex * dimensions.x;
+/// Same as calling plant_tick `ticks` times, in a time that depends on how many times the levels
+/// of the plant change instead of on the amount of ticks. For the time the game was not running
+void plant_advanceTicks(Plant *plant, long ticks) {
+    plant_advanceTicksWithDefinition(plant, &plantDefinitions[plant->type], ticks);
+}
 
-    return (Rectangle){
-        origin.x,
-        origin.y,
-        dimensions.x,
-        dimensions.y,
+// Forecast: the same segments as plant_advanceTicks, kept as points. The levels that matter are
+// only checked where they can change, at the segments, so a forecast of a day costs about as much
+// as the level changes in it
+
+/// First tick (1 to `ticks`) after which `value` is below `level` taking `change` every tick, -1
+/// if it isn't in `ticks`. `value` must not be below `level` already
+static long getTicksToBelowLevel(PlantStat value, int change, long ticks, int level) {
+    const int statPerLevel = PLANT_STAT_MAX / PLANT_STATUS_LEVEL_COUNT;
+
+    if (change >= 0) {
+        return -1;
+    }
+
+    // being clamped at 0 only gets it there earlier
+    long ticksToBelow = (value - statPerLevel * level) / -change + 1;
+
+    return ticksToBelow <= ticks ? ticksToBelow : -1;
+}
+
+static PlantForecastPoint getForecastPoint(const Plant *plant, long ticks) {
+    return (PlantForecastPoint){
+        .ticks = ticks,
+        .mediumHydration = plant->mediumHydration,
+        .mediumNutrition = plant->mediumNutrition,
+        .hydration = plant->hydration,
+        .nutrition = plant->nutrition,
+        .health = plant->health,
     };
 }
 
-/// The plant is drawn with the center of its base at the origin
-void plant_draw(Plant *plant, Vector2 origin, float scale, Color color) {
-    Rectangle source = plant_getSpriteSourceRect(plant->type, plant->health);
+/// Forecasts `plant` for the next `hours` of game time if it isn't watered nor fed: the curves
+/// of its stats and when it will be dry and dying
+void plant_forecast(const Plant *plant, float hours, PlantForecast *forecast) {
+    const PlantDefinition *props = &plantDefinitions[plant->type];
+    const float plantSeconds = hours * 60 * 60 / GAME_SECONDS_PER_RL_SECONDS;
+    const long maxTicks = plantSeconds / props->secondsPerTick;
 
-    Rectangle dest = {
-        origin.x,
-        origin.y,
-        source.width * scale,
-        source.height * scale,
-    };
+    Plant p = *plant;
+    long ticks = 0;
+
+    forecast->from = *plant;
+    forecast->pointsCount = 0;
+    forecast->ticksToDry
+        = plant_getStatLevel(p.hydration) < PLANT_OPTIMAL_HYDRATION_LEVEL ? 0 : -1;
+    forecast->ticksToDying = plant_getStatLevel(p.health) <= PLANT_HEALTH_LEVEL_DYING ? 0 : -1;
+
+    while (true) {
+        forecast->points[forecast->pointsCount++] = getForecastPoint(&p, ticks);
+
+        if (ticks >= maxTicks || forecast->pointsCount == PLANT_FORECAST_MAX_POINTS) {
+            break;
+        }
+
+        PlantChanges changes = getTickChanges(&p, props);
+        long segmentTicks = plant_getSegmentTicks(&p, &changes, maxTicks - ticks);
+        Plant next = p;
+
+        applyTickChanges(&next, props, &changes, segmentTicks);
 
-    Vector2 pivot = {dest.width / 2, dest.height};
+        if (forecast->ticksToDry == -1) {
+            // the reset is a single tick, and doesn't go with the change
+            long ticksToDry = changes.hydrationReset
+                ? (plant_getStatLevel(next.hydration) < PLANT_OPTIMAL_HYDRATION_LEVEL ? 1 : -1)
+                : getTicksToBelowLevel(p.hydration,
+                      changes.hydration,
+                      segmentTicks,
+                      PLANT_OPTIMAL_HYDRATION_LEVEL);
+
+            if (ticksToDry != -1) {
+                forecast->ticksToDry = ticks + ticksToDry;
+            }
+        }
+
+        if (forecast->ticksToDying == -1) {
+            long ticksToDying = getTicksToBelowLevel(
+                p.health, changes.health, segmentTicks, PLANT_HEALTH_LEVEL_DYING + 1);
+
+            if (ticksToDying != -1) {
+                forecast->ticksToDying = ticks + ticksToDying;
+            }
+        }
+
+        p = next;
+        ticks += segmentTicks;
+    }
+
+    forecast->ticks = ticks;
+}
+
+/// Whether `plant` is as `forecast` said it would be by now: the same plant, not cared for since
+/// and not past the end of the forecast. Then the forecast still holds and doesn't have to be made
+/// again
+bool plant_isForecastOf(const PlantForecast *forecast, const Plant *plant) {
+    const Plant *from = &forecast->from;
+
+    if (forecast->pointsCount == 0 || !plant->exists || !from->exists
+        || plant->type != from->type || plant->genome != from->genome
+        || plant->infected != from->infected || plant->temperature != from->temperature
+        || plant->light != from->light || plant->irrigation != from->irrigation) {
+        return false;
+    }
+
+    long ticks = plant->ticksCount - from->ticksCount;
+
+    if (ticks < 0 || ticks > forecast->ticks) {
+        return false;
+    }
+
+    // last point at or before `ticks`
+    int low = 0;
+    int high = forecast->pointsCount - 1;
+
+    while (low < high) {
+        int middle = (low + high + 1) / 2;
+
+        if (forecast->points[middle].ticks <= ticks) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    const PlantForecastPoint *point = &forecast->points[low];
+    const PlantDefinition *props = &plantDefinitions[from->type];
+    Plant expected = *from;
+
+    expected.mediumHydration = point->mediumHydration;
+    expected.mediumNutrition = point->mediumNutrition;
+    expected.hydration = point->hydration;
+    expected.nutrition = point->nutrition;
+    expected.health = point->health;
+
+    if (ticks > point->ticks) {
+        PlantChanges changes = getTickChanges(&expected, props);
+        applyTickChanges(&expected, props, &changes, ticks - point->ticks);
+    }
 
-    DrawTexturePro(plantAtlas, source, dest, pivot, 0, color);
+    return expected.mediumHydration == plant->mediumHydration
+        && expected.mediumNutrition == plant->mediumNutrition
+        && expected.hydration == plant->hydration && expected.nutrition == plant->nutrition
+        && expected.health == plant->health;
 }
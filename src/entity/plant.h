@@ -1,10 +1,28 @@
 #pragma once
-#include <raylib.h>
+#include "../utils/raylib_types.h"
+#include <stdbool.h>
+#include <stdint.h>
 
 #define PLANT_SPRITE_WIDTH 64
 #define PLANT_SPRITE_HEIGHT 64
 #define PLANT_STATUS_LEVEL_COUNT 5
 
+/// Stats are 8.8 fixed point: points (0 to 100) in the high byte and 1/256ths of a point in the
+/// low one. All the update rules are integer math on them
+typedef uint16_t PlantStat;
+
+#define PLANT_STAT_ONE 256
+#define PLANT_STAT_MAX (100 * PLANT_STAT_ONE)
+/// PlantStat of a whole amount of points
+#define PLANT_STAT(points) ((points) * PLANT_STAT_ONE)
+/// most points a stat can have and still be at `level`, a point more is the next one
+#define PLANT_MAX_POINTS_FOR_LEVEL(level) ((100 / PLANT_STATUS_LEVEL_COUNT) * ((level) + 1) - 1)
+
+/// the hydration the rules ask for, see getChanges
+#define PLANT_OPTIMAL_HYDRATION_LEVEL 2
+/// the top of the optimal hydration level, where PlantChanges.hydrationReset takes it back to
+#define PLANT_HYDRATION_RESET PLANT_STAT(PLANT_MAX_POINTS_FOR_LEVEL(PLANT_OPTIMAL_HYDRATION_LEVEL))
+
 enum PlantType {
     PLANT_TYPE_CRASSULA_OVATA,     // jade
     PLANT_TYPE_SENECIO_ROWLEYANUS, // string of pearls
@@ -27,6 +45,46 @@ typedef enum {
     PLANT_HEALTH_LEVEL_THRIVING,
 } PlantHealthLevel;
 
+/// Growth stages by biomass, each a quarter of PLANT_BIOMASS_MAX. Only the stage is drawn, so a
+/// plant looks the same until it gets to the next one
+typedef enum {
+    PLANT_GROWTH_STAGE_SPROUT,
+    PLANT_GROWTH_STAGE_YOUNG,
+    PLANT_GROWTH_STAGE_GROWN,
+    /// to be pruned
+    PLANT_GROWTH_STAGE_OVERGROWN,
+    PLANT_GROWTH_STAGE_COUNT,
+} PlantGrowthStage;
+
+/// Biomass is in PlantStat units, but goes up to 1000 points
+#define PLANT_BIOMASS_MAX PLANT_STAT(1000)
+#define PLANT_BIOMASS_PER_STAGE (PLANT_BIOMASS_MAX / PLANT_GROWTH_STAGE_COUNT)
+
+/// The temperature of the tile of a plant as the rules see it, see plant_getTemperature
+typedef enum {
+    PLANT_TEMPERATURE_MILD,
+    /// doesn't grow
+    PLANT_TEMPERATURE_COLD,
+    /// the soil dries faster
+    PLANT_TEMPERATURE_HOT,
+} PlantTemperature;
+
+#define PLANT_TEMPERATURE_COLD_BELOW 10.0f
+#define PLANT_TEMPERATURE_HOT_ABOVE 28.0f
+
+/// The light of the tiles of a plant as the rules see it, see plant_getLight
+typedef enum {
+    PLANT_LIGHT_FULL,
+    /// grows half a point a second slower
+    PLANT_LIGHT_PARTIAL,
+    /// doesn't grow
+    PLANT_LIGHT_SHADE,
+} PlantLight;
+
+/// hours of full sun a day, see LightIntegral
+#define PLANT_LIGHT_SHADE_BELOW 0.5f
+#define PLANT_LIGHT_PARTIAL_BELOW 2.0f
+
 typedef enum {
     PLANT_NUTRIENT_LEVEL_1,
     PLANT_NUTRIENT_LEVEL_2,
@@ -46,26 +104,111 @@ typedef struct {
     bool underNutritionResiliece;
     PlantWaterLevel optimalWaterLevel;
     PlantNutrientsLevel optimalNutrientsLevel;
+    /// fixed time step of the plant, a multiple of 1/128 seconds so a tick of the rates (half
+    /// points per second) is a whole amount of PlantStat units
+    float secondsPerTick;
 } PlantDefinition;
 
+/// Genes of a plant, PLANT_GENE_BITS bits each, see plant_genome.h. A zero genome is the wild
+/// type, which has the traits of its PlantDefinition
+typedef uint16_t PlantGenome;
+
+/// What the genome makes of the definition of the species, worked out once when the plant is
+/// created (plantGenome_express) so the rules read them as they are
+typedef struct {
+    /// PlantWaterLevel of the soil the plant takes water best from
+    uint8_t optimalWaterLevel;
+    /// level of the nutrition the plant is healthiest at
+    uint8_t optimalNutritionLevel;
+    /// half points of health a second the plant doesn't lose when it is dry
+    uint8_t droughtResilience;
+} PlantTraits;
+
 typedef struct {
     enum PlantType type;
     bool exists;
-    float mediumHydration;
-    float mediumNutrition;
-    float hydration;
-    float nutrition;
-    float health;
-    float timeSinceLastTick;
+    PlantGenome genome;
+    PlantTraits traits;
+    /// caught the disease of its planter, see DiseaseGrid. Loses health while it lasts
+    bool infected;
+    /// of the tiles of its planter, see TemperatureField
+    PlantTemperature temperature;
+    /// of the tiles of its planter over the last days, see LightIntegral
+    PlantLight light;
+    /// half points a second of water its soil gets from the drippers of its planter (see
+    /// IrrigationNetwork) and the rain (see Weather)
+    uint8_t irrigation;
+    PlantStat mediumHydration;
+    PlantStat mediumNutrition;
+    PlantStat hydration;
+    PlantStat nutrition;
+    PlantStat health;
+    int biomass;
     int ticksCount;
 } Plant;
 
+/// What one update adds to each stat (in PlantStat units), before clamping. A segment is the run
+/// of ticks that add the same changes, see plant_getSegmentTicks
+typedef struct {
+    int mediumHydration;
+    int mediumNutrition;
+    int hydration;
+    int nutrition;
+    int health;
+    int biomass;
+    /// the hydration goes back to the top of the optimal level before the change is added
+    bool hydrationReset;
+} PlantChanges;
+
+/// most points a forecast keeps, it ends early if the plant changes levels more times
+#define PLANT_FORECAST_MAX_POINTS 64
+
+/// State of a forecast plant at the start of a segment
+typedef struct {
+    /// ticks since the forecast was made
+    long ticks;
+    PlantStat mediumHydration;
+    PlantStat mediumNutrition;
+    PlantStat hydration;
+    PlantStat nutrition;
+    PlantStat health;
+} PlantForecastPoint;
+
+/// How a plant will be if nobody cares for it, see plant_forecast. The stats between two points
+/// change by the same amount every tick, so the points are the whole curves
+typedef struct {
+    /// the plant as it was when forecast
+    Plant from;
+    /// ticks the forecast covers, up to the last point
+    long ticks;
+    int pointsCount;
+    PlantForecastPoint points[PLANT_FORECAST_MAX_POINTS];
+    /// ticks until the hydration goes below the optimal level, -1 if not in the forecast
+    long ticksToDry;
+    /// ticks until the health gets to PLANT_HEALTH_LEVEL_DYING, -1 if not in the forecast
+    long ticksToDying;
+} PlantForecast;
+
 extern const PlantDefinition plantDefinitions[PLANT_TYPE_COUNT];
 
 void plant_init(Plant *p, enum PlantType type);
+void plant_initWithGenome(Plant *p, enum PlantType type, PlantGenome genome);
 void plant_irrigate(Plant *p);
 void plant_feed(Plant *p);
+void plant_prune(Plant *p);
+PlantTemperature plant_getTemperature(float degrees);
+PlantLight plant_getLight(float sunHours);
+PlantGrowthStage plant_getGrowthStage(int biomass);
+const char *plant_getGrowthStageName(PlantGrowthStage stage);
 void plant_update(Plant *plant, float deltaTime);
+void plant_tick(Plant *plant);
+void plant_advanceTicks(Plant *plant, long ticks);
+void plant_advanceTicksWithDefinition(Plant *plant, const PlantDefinition *props, long ticks);
+PlantChanges plant_getTickChanges(const Plant *plant);
+long plant_getSegmentTicks(const Plant *plant, const PlantChanges *changes, long maxTicks);
+void plant_applyTickChanges(Plant *plant, const PlantChanges *changes, long ticks);
+void plant_forecast(const Plant *plant, float hours, PlantForecast *forecast);
+bool plant_isForecastOf(const PlantForecast *forecast, const Plant *plant);
 Rectangle plant_getSpriteSourceRect(enum PlantType type, int health);
 void plant_draw(Plant *plant, Vector2 origin, float scale, Color color);
-int plant_getStatLevel(float statValue);
+int plant_getStatLevel(int statValue);
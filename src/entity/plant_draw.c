@@ -0,0 +1,71 @@
+#include "plant.h"
+#include "../core/asset_manager.h"
+#include <raylib.h>
+
+Rectangle plant_getSpriteSourceRect(enum PlantType type, int health) {
+    Vector2 dimensions = plantDefinitions[type].spriteDimensions;
+    // Position in the sprite atlas
+    Vector2 origin = {0, 0};
+
+    for (int i = 0; i < type; i++) {
+        if (i == type) {
+            break;
+        }
+
+        Vector2 d = plantDefinitions[i].spriteDimensions;
+
+        origin.y += d.y;
+    }
+
+    // use enum?
+    int spriteIndex;
+    if (health > 70) {
+        spriteIndex = 0;
+    } else if (health > 50) {
+        spriteIndex = 1;
+    } else if (health > 40) {
+        spriteIndex = 2;
+    } else if (health > 20) {
+        spriteIndex = 3;
+    } else if (health > 10) {
+        spriteIndex = 4;
+    } else {
+        spriteIndex = 5;
+    }
+
+    origin.x = spriteIndex * dimensions.x;
+
+    return (Rectangle){
+        origin.x,
+        origin.y,
+        dimensions.x,
+        dimensions.y,
+    };
+}
+
+/// size of the sprite by growth stage
+static const float growthStageScales[PLANT_GROWTH_STAGE_COUNT] = {0.55f, 0.7f, 0.85f, 1.0f};
+
+/// The plant is drawn with the center of its base at the origin, as big as its growth stage.
+/// Yellowish if it is infected
+void plant_draw(Plant *plant, Vector2 origin, float scale, Color color) {
+    Rectangle source = plant_getSpriteSourceRect(plant->type, plant->health / PLANT_STAT_ONE);
+
+    if (plant->infected) {
+        color.g = color.g * 9 / 10;
+        color.b = color.b / 2;
+    }
+
+    scale *= growthStageScales[plant_getGrowthStage(plant->biomass)];
+
+    Rectangle dest = {
+        origin.x,
+        origin.y,
+        source.width * scale,
+        source.height * scale,
+    };
+
+    Vector2 pivot = {dest.width / 2, dest.height};
+
+    DrawTexturePro(plantAtlas, source, dest, pivot, 0, color);
+}
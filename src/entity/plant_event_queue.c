@@ -0,0 +1,149 @@
+#include "plant_event_queue.h"
+#include "../utils/utils.h"
+#include <assert.h>
+
+void plantEventQueue_init(PlantEventQueue *queue) {
+    for (int type = 0; type < PLANT_TYPE_COUNT; type++) {
+        queue->count[type] = 0;
+    }
+
+    for (int i = 0; i < GARDEN_MAX_PLANTS; i++) {
+        queue->indexOf[i] = -1;
+    }
+
+    queue->hash = 0;
+}
+
+/// Hash of a queued plant, XORed into PlantEventQueue.hash
+static uint64_t hashEvent(const PlantEventQueue *queue, int plantId) {
+    uint64_t words[] = {plantId, queue->typeOf[plantId], queue->dueAt[plantId]};
+
+    return utils_hashWords(words, sizeof(words) / sizeof(words[0]));
+}
+
+static void place(PlantEventQueue *queue, enum PlantType type, int index, int plantId) {
+    queue->heap[type][index] = plantId;
+    queue->indexOf[plantId] = index;
+}
+
+static void siftUp(PlantEventQueue *queue, enum PlantType type, int index) {
+    int plantId = queue->heap[type][index];
+
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        int parentId = queue->heap[type][parent];
+
+        if (queue->dueAt[parentId] <= queue->dueAt[plantId]) {
+            break;
+        }
+
+        place(queue, type, index, parentId);
+        index = parent;
+    }
+
+    place(queue, type, index, plantId);
+}
+
+static void siftDown(PlantEventQueue *queue, enum PlantType type, int index) {
+    int plantId = queue->heap[type][index];
+    int count = queue->count[type];
+
+    while (true) {
+        int child = index * 2 + 1;
+
+        if (child >= count) {
+            break;
+        }
+
+        // the earliest of both children
+        const int *heap = queue->heap[type];
+        if (child + 1 < count && queue->dueAt[heap[child + 1]] < queue->dueAt[heap[child]]) {
+            child++;
+        }
+
+        int childId = queue->heap[type][child];
+
+        if (queue->dueAt[plantId] <= queue->dueAt[childId]) {
+            break;
+        }
+
+        place(queue, type, index, childId);
+        index = child;
+    }
+
+    place(queue, type, index, plantId);
+}
+
+/// Queues the plant, or moves it if it was already queued
+void plantEventQueue_set(
+    PlantEventQueue *queue, int plantId, enum PlantType type, long long dueAt) {
+    assert(plantId >= 0 && plantId < GARDEN_MAX_PLANTS);
+
+    if (queue->indexOf[plantId] != -1 && queue->typeOf[plantId] != type) {
+        plantEventQueue_remove(queue, plantId);
+    }
+
+    int index = queue->indexOf[plantId];
+
+    if (index != -1) {
+        queue->hash ^= hashEvent(queue, plantId);
+    }
+
+    queue->dueAt[plantId] = dueAt;
+    queue->typeOf[plantId] = type;
+    queue->hash ^= hashEvent(queue, plantId);
+
+    if (index == -1) {
+        index = queue->count[type]++;
+        place(queue, type, index, plantId);
+    }
+
+    siftUp(queue, type, index);
+    siftDown(queue, type, queue->indexOf[plantId]);
+}
+
+void plantEventQueue_remove(PlantEventQueue *queue, int plantId) {
+    int index = queue->indexOf[plantId];
+
+    if (index == -1) {
+        return;
+    }
+
+    queue->hash ^= hashEvent(queue, plantId);
+
+    enum PlantType type = queue->typeOf[plantId];
+    int lastIndex = --queue->count[type];
+    int lastId = queue->heap[type][lastIndex];
+
+    queue->indexOf[plantId] = -1;
+
+    if (lastId == plantId) {
+        return;
+    }
+
+    // the last plant takes the hole and goes wherever it belongs from there
+    place(queue, type, index, lastId);
+    siftUp(queue, type, index);
+    siftDown(queue, type, queue->indexOf[lastId]);
+}
+
+void plantEventQueue_clear(PlantEventQueue *queue) {
+    for (int type = 0; type < PLANT_TYPE_COUNT; type++) {
+        for (int i = 0; i < queue->count[type]; i++) {
+            queue->indexOf[queue->heap[type][i]] = -1;
+        }
+
+        queue->count[type] = 0;
+    }
+
+    queue->hash = 0;
+}
+
+/// The plant of `type` whose event is the earliest, or -1 if none is queued
+int plantEventQueue_peek(const PlantEventQueue *queue, enum PlantType type) {
+    if (queue->count[type] == 0) {
+        return -1;
+    }
+
+    return queue->heap[type][0];
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "plant.h"
+#include "planter.h"
+#include <stdint.h>
+
+/// Plants of each species in a min-heap by the pop of their wheel (see PlantScheduler) at which
+/// their current segment ends, for the event driven simulation. Like the scheduler it works by
+/// plant id and doesn't use malloc
+typedef struct {
+    int heap[PLANT_TYPE_COUNT][GARDEN_MAX_PLANTS];
+    int count[PLANT_TYPE_COUNT];
+    /// position in the heap of its species, -1 when the plant is not queued
+    int indexOf[GARDEN_MAX_PLANTS];
+    enum PlantType typeOf[GARDEN_MAX_PLANTS];
+    long long dueAt[GARDEN_MAX_PLANTS];
+    /// of the queued plants and their `dueAt`, kept up to date by every change. Not of the heap:
+    /// plants due at the same pop can come in any order, their updates don't depend on each other
+    uint64_t hash;
+} PlantEventQueue;
+
+void plantEventQueue_init(PlantEventQueue *queue);
+void plantEventQueue_set(
+    PlantEventQueue *queue, int plantId, enum PlantType type, long long dueAt);
+void plantEventQueue_remove(PlantEventQueue *queue, int plantId);
+void plantEventQueue_clear(PlantEventQueue *queue);
+int plantEventQueue_peek(const PlantEventQueue *queue, enum PlantType type);
@@ -0,0 +1,62 @@
+#include "plant_genome.h"
+
+/// one bit at the bottom of each gene
+#define PLANT_GENOME_LOW_BITS (PLANT_GENOME_BITS / PLANT_GENE_MASK)
+
+int plantGenome_getAllele(PlantGenome genome, PlantGene gene) {
+    return genome >> (gene * PLANT_GENE_BITS) & PLANT_GENE_MASK;
+}
+
+/// Level a level gene moves the definition by: the first two alleles don't, so half the mutations
+/// of these genes don't show
+static int getLevelOffset(int allele) {
+    static const int offsets[PLANT_GENE_MASK + 1] = {0, 0, 1, -1};
+
+    return offsets[allele];
+}
+
+static int clampLevel(int level) {
+    if (level < 0) {
+        return 0;
+    }
+
+    if (level > PLANT_STATUS_LEVEL_COUNT - 1) {
+        return PLANT_STATUS_LEVEL_COUNT - 1;
+    }
+
+    return level;
+}
+
+/// Traits of a plant of the species `props` with `genome`. The wild type (a zero genome) gets the
+/// ones of the definition
+PlantTraits plantGenome_express(PlantGenome genome, const PlantDefinition *props) {
+    int waterOffset = getLevelOffset(plantGenome_getAllele(genome, PLANT_GENE_WATER_LEVEL));
+    int nutritionOffset
+        = getLevelOffset(plantGenome_getAllele(genome, PLANT_GENE_NUTRITION_LEVEL));
+
+    return (PlantTraits){
+        .optimalWaterLevel = clampLevel(props->optimalWaterLevel + waterOffset),
+        .optimalNutritionLevel = clampLevel(props->optimalNutrientsLevel + nutritionOffset),
+        .droughtResilience = plantGenome_getAllele(genome, PLANT_GENE_DROUGHT_RESILIENCE),
+    };
+}
+
+/// Uniform crossover: each gene from `a` or `b` by a bit of `random`. The low bit of each gene
+/// times PLANT_GENE_MASK covers the whole gene, as the genes don't overlap
+PlantGenome plantGenome_cross(PlantGenome a, PlantGenome b, uint64_t random) {
+    PlantGenome fromA = (random & PLANT_GENOME_LOW_BITS) * PLANT_GENE_MASK;
+
+    return (a & fromA) | (b & ~fromA);
+}
+
+/// Flips the gene bits set in all the slices of `random`
+PlantGenome plantGenome_mutate(PlantGenome genome, uint64_t random) {
+    const int sliceBits = 64 / PLANT_GENOME_MUTATION_SLICES;
+    uint64_t flips = random;
+
+    for (int i = 1; i < PLANT_GENOME_MUTATION_SLICES; i++) {
+        flips &= random >> (i * sliceBits);
+    }
+
+    return genome ^ (flips & PLANT_GENOME_BITS);
+}
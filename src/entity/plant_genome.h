@@ -0,0 +1,34 @@
+#pragma once
+
+#include "plant.h"
+#include <stdint.h>
+
+// Genetics: a PlantGenome is a row of fixed-width alleles, one per PlantGene, that move the traits
+// of the definition of the species a bit. Offspring take each gene from one of two parents and
+// flip a bit now and then, all with a few bitwise operations on the whole genome. The genome is
+// expressed into PlantTraits once, when the plant is created, and the rules only read the traits
+
+#define PLANT_GENE_BITS 2
+#define PLANT_GENE_MASK ((1 << PLANT_GENE_BITS) - 1)
+
+typedef enum {
+    /// moves the optimal water level of the soil one level up or down
+    PLANT_GENE_WATER_LEVEL,
+    /// moves the optimal nutrition level one level up or down
+    PLANT_GENE_NUTRITION_LEVEL,
+    /// the allele is the drought resilience, in half points of health a second
+    PLANT_GENE_DROUGHT_RESILIENCE,
+    PLANT_GENE_COUNT,
+} PlantGene;
+
+_Static_assert(PLANT_GENE_COUNT * PLANT_GENE_BITS <= sizeof(PlantGenome) * 8, "genes fit");
+
+/// the bits of the genome that are genes
+#define PLANT_GENOME_BITS ((1 << (PLANT_GENE_COUNT * PLANT_GENE_BITS)) - 1)
+/// each bit of a genome flips with a chance of 1 in 2^PLANT_GENOME_MUTATION_SLICES on mutation
+#define PLANT_GENOME_MUTATION_SLICES 4
+
+int plantGenome_getAllele(PlantGenome genome, PlantGene gene);
+PlantTraits plantGenome_express(PlantGenome genome, const PlantDefinition *props);
+PlantGenome plantGenome_cross(PlantGenome a, PlantGenome b, uint64_t random);
+PlantGenome plantGenome_mutate(PlantGenome genome, uint64_t random);
@@ -0,0 +1,178 @@
+#include "plant_scheduler.h"
+#include "plant.h"
+#include "../utils/utils.h"
+#include <assert.h>
+
+static double getSlotDuration(enum PlantType type) {
+    return plantDefinitions[type].secondsPerTick / PLANT_SCHEDULER_SLOTS;
+}
+
+// The cursor starts at slot 0 and moves one slot per pop, so the n-th pop (from 0) is over slot
+// n % PLANT_SCHEDULER_SLOTS
+
+/// Times the cursor passed over `slot` of the wheel of `type` since the start
+static long long getPasses(const PlantScheduler *scheduler, enum PlantType type, int slot) {
+    long long popped = scheduler->slotsPopped[type];
+
+    return (popped + PLANT_SCHEDULER_SLOTS - 1 - slot) / PLANT_SCHEDULER_SLOTS;
+}
+
+/// Hash of the place of a scheduled plant, XORed into PlantScheduler.hash
+static uint64_t hashPlant(const PlantScheduler *scheduler, int plantId) {
+    uint64_t words[] = {
+        plantId,
+        scheduler->typeOf[plantId],
+        scheduler->slotOf[plantId],
+        scheduler->passesAtAdd[plantId],
+    };
+
+    return utils_hashWords(words, sizeof(words) / sizeof(words[0]));
+}
+
+void plantScheduler_init(PlantScheduler *scheduler) {
+    for (int type = 0; type < PLANT_TYPE_COUNT; type++) {
+        for (int slot = 0; slot < PLANT_SCHEDULER_SLOTS; slot++) {
+            scheduler->slotHead[type][slot] = -1;
+        }
+
+        scheduler->cursor[type] = 0;
+        scheduler->nextSlotToFill[type] = 0;
+        scheduler->slotsPopped[type] = 0;
+        scheduler->elapsed[type] = 0;
+    }
+
+    for (int i = 0; i < GARDEN_MAX_PLANTS; i++) {
+        scheduler->next[i] = -1;
+        scheduler->prev[i] = -1;
+        scheduler->slotOf[i] = -1;
+    }
+
+    scheduler->hash = 0;
+}
+
+void plantScheduler_add(PlantScheduler *scheduler, int plantId, enum PlantType type) {
+    assert(plantId >= 0 && plantId < GARDEN_MAX_PLANTS);
+
+    if (scheduler->slotOf[plantId] != -1) {
+        plantScheduler_remove(scheduler, plantId);
+    }
+
+    // round robin so every slot of the wheel has (about) the same amount of plants
+    int slot = scheduler->nextSlotToFill[type];
+    scheduler->nextSlotToFill[type] = (slot + 1) % PLANT_SCHEDULER_SLOTS;
+
+    int head = scheduler->slotHead[type][slot];
+
+    scheduler->next[plantId] = head;
+    scheduler->prev[plantId] = -1;
+
+    if (head != -1) {
+        scheduler->prev[head] = plantId;
+    }
+
+    scheduler->slotHead[type][slot] = plantId;
+    scheduler->slotOf[plantId] = slot;
+    scheduler->typeOf[plantId] = type;
+    scheduler->passesAtAdd[plantId] = getPasses(scheduler, type, slot);
+    scheduler->hash ^= hashPlant(scheduler, plantId);
+}
+
+void plantScheduler_remove(PlantScheduler *scheduler, int plantId) {
+    int slot = scheduler->slotOf[plantId];
+
+    if (slot == -1) {
+        return;
+    }
+
+    scheduler->hash ^= hashPlant(scheduler, plantId);
+
+    int next = scheduler->next[plantId];
+    int prev = scheduler->prev[plantId];
+
+    if (prev != -1) {
+        scheduler->next[prev] = next;
+    } else {
+        scheduler->slotHead[scheduler->typeOf[plantId]][slot] = next;
+    }
+
+    if (next != -1) {
+        scheduler->prev[next] = prev;
+    }
+
+    scheduler->next[plantId] = -1;
+    scheduler->prev[plantId] = -1;
+    scheduler->slotOf[plantId] = -1;
+}
+
+void plantScheduler_advance(PlantScheduler *scheduler, double deltaTime) {
+    for (int type = 0; type < PLANT_TYPE_COUNT; type++) {
+        scheduler->elapsed[type] += deltaTime;
+    }
+}
+
+/// Returns the next slot of the wheel of `type` whose plants are due for a tick, or -1 if the
+/// cursor is up to date. Call it until it returns -1; plants of the slot can be iterated with
+/// `slotHead` and `next`
+int plantScheduler_popDueSlot(PlantScheduler *scheduler, enum PlantType type) {
+    double slotDuration = getSlotDuration(type);
+
+    if (scheduler->elapsed[type] < slotDuration) {
+        return -1;
+    }
+
+    scheduler->elapsed[type] -= slotDuration;
+    scheduler->slotsPopped[type]++;
+
+    int slot = scheduler->cursor[type];
+    scheduler->cursor[type] = (slot + 1) % PLANT_SCHEDULER_SLOTS;
+
+    return slot;
+}
+
+/// Whether the wheel of `type` has to pass over all of its slots, or more, to be up to date
+bool plantScheduler_isTurnBehind(const PlantScheduler *scheduler, enum PlantType type) {
+    return scheduler->elapsed[type] >= getSlotDuration(type) * PLANT_SCHEDULER_SLOTS;
+}
+
+/// Brings the wheel of `type` up to date at once, instead of popping its due slots one by one.
+/// `ticksBySlot` gets how many times the cursor passed over each slot, which is the amount of
+/// ticks its plants are due
+void plantScheduler_skipDueSlots(
+    PlantScheduler *scheduler, enum PlantType type, long ticksBySlot[PLANT_SCHEDULER_SLOTS]) {
+    double slotDuration = getSlotDuration(type);
+    long slotsDue = scheduler->elapsed[type] / slotDuration;
+
+    scheduler->elapsed[type] -= slotsDue * slotDuration;
+
+    int cursor = scheduler->cursor[type];
+
+    for (int i = 0; i < PLANT_SCHEDULER_SLOTS; i++) {
+        // the first `slotsDue % SLOTS` slots from the cursor get an extra pass
+        int slot = (cursor + i) % PLANT_SCHEDULER_SLOTS;
+        bool extraPass = i < slotsDue % PLANT_SCHEDULER_SLOTS;
+        ticksBySlot[slot] = slotsDue / PLANT_SCHEDULER_SLOTS + extraPass;
+    }
+
+    scheduler->cursor[type] = (cursor + slotsDue) % PLANT_SCHEDULER_SLOTS;
+    scheduler->slotsPopped[type] += slotsDue;
+}
+
+/// Ticks the plant is behind, given the ones it already got
+long plantScheduler_getDueTicks(const PlantScheduler *scheduler, int plantId, int ticksCount) {
+    int slot = scheduler->slotOf[plantId];
+    assert(slot != -1);
+
+    long long passes = getPasses(scheduler, scheduler->typeOf[plantId], slot);
+
+    return passes - scheduler->passesAtAdd[plantId] - ticksCount;
+}
+
+/// Pops of the wheel of the plant after which it is due `ticksCount` ticks in total
+long long plantScheduler_getPopsForTicks(
+    const PlantScheduler *scheduler, int plantId, long ticksCount) {
+    int slot = scheduler->slotOf[plantId];
+    long long passes = scheduler->passesAtAdd[plantId] + ticksCount;
+    assert(slot != -1 && passes > 0);
+
+    return (passes - 1) * PLANT_SCHEDULER_SLOTS + slot + 1;
+}
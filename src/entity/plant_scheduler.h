@@ -0,0 +1,46 @@
+#pragma once
+
+#include "planter.h"
+#include "plant.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Slots of the timing wheel of each species. A plant is parked in one slot and gets ticked each
+// time the cursor passes over it, so the plants of a species are spread across the frames of one
+// tick interval instead of all being updated in the same frame
+#define PLANT_SCHEDULER_SLOTS 16
+
+/// Timing wheel per species. Lists of the slots are intrusive (`next`/`prev` by plant id) to avoid
+/// malloc, the same as the rest of the garden
+typedef struct {
+    int slotHead[PLANT_TYPE_COUNT][PLANT_SCHEDULER_SLOTS];
+    int next[GARDEN_MAX_PLANTS];
+    int prev[GARDEN_MAX_PLANTS];
+    /// -1 when the plant is not scheduled
+    int slotOf[GARDEN_MAX_PLANTS];
+    enum PlantType typeOf[GARDEN_MAX_PLANTS];
+    /// passes over the slot of the plant when it was added. The ticks a plant is due are the
+    /// passes since then that are not in its `ticksCount` yet
+    long long passesAtAdd[GARDEN_MAX_PLANTS];
+    int cursor[PLANT_TYPE_COUNT];
+    int nextSlotToFill[PLANT_TYPE_COUNT];
+    /// times the cursor moved since the start, a clock for the plants of the wheel
+    long long slotsPopped[PLANT_TYPE_COUNT];
+    /// time accumulated since the cursor of the wheel moved
+    double elapsed[PLANT_TYPE_COUNT];
+    /// of the plants in the wheels, their slots and `passesAtAdd`, kept up to date by add and
+    /// remove (see garden_getStateHash)
+    uint64_t hash;
+} PlantScheduler;
+
+void plantScheduler_init(PlantScheduler *scheduler);
+void plantScheduler_add(PlantScheduler *scheduler, int plantId, enum PlantType type);
+void plantScheduler_remove(PlantScheduler *scheduler, int plantId);
+void plantScheduler_advance(PlantScheduler *scheduler, double deltaTime);
+int plantScheduler_popDueSlot(PlantScheduler *scheduler, enum PlantType type);
+bool plantScheduler_isTurnBehind(const PlantScheduler *scheduler, enum PlantType type);
+void plantScheduler_skipDueSlots(
+    PlantScheduler *scheduler, enum PlantType type, long ticksBySlot[PLANT_SCHEDULER_SLOTS]);
+long plantScheduler_getDueTicks(const PlantScheduler *scheduler, int plantId, int ticksCount);
+long long plantScheduler_getPopsForTicks(
+    const PlantScheduler *scheduler, int plantId, long ticksCount);
@@ -0,0 +1,704 @@
+#include "plant_store.h"
+#include "plant.h"
+#include "../utils/utils.h"
+#include <assert.h>
+#include <string.h>
+
+// The kernel works on PLANT_KERNEL_LANES plants at a time with gcc vector extensions, as wide as
+// the target allows (i.e. with -march=native): 16 with AVX-512, 8 with AVX, 4 with plain SSE.
+// The stats are widened to 32 bit lanes. It follows plant_update operation by operation so both
+// give the same results; the branches of the rules are replaced by masks. If plant_update
+// changes, this has to change too
+#if defined(__AVX512F__)
+#define PLANT_KERNEL_LANES 16
+#elif defined(__AVX__)
+#define PLANT_KERNEL_LANES 8
+#else
+#define PLANT_KERNEL_LANES 4
+#endif
+
+typedef int i32xN __attribute__((vector_size(PLANT_KERNEL_LANES * sizeof(int))));
+
+void plantStore_init(PlantStore *store) {
+    for (int i = 0; i < GARDEN_MAX_PLANTS; i++) {
+        store->exists[i] = false;
+    }
+
+    store->stats = (PlantStoreStats){0};
+    memset(store->levelIndex, 0, sizeof(store->levelIndex));
+    memset(store->underfed, 0, sizeof(store->underfed));
+    memset(store->hashDirty, 0, sizeof(store->hashDirty));
+    memset(store->plantHash, 0, sizeof(store->plantHash));
+    store->hash = 0;
+}
+
+// Aggregates: each write takes the old values of the plant out of them and puts the new ones in.
+// Writes to different plants run in parallel jobs, so a write works out what it changes in a
+// PlantStoreStats of its own and adds it with atomic adds. The aggregates are integers, so they
+// come out the same whatever the order of the adds
+
+/// Level of a stat for the aggregates, with a full stat in the top level
+static int getStatsLevel(int statValue) {
+    int level = plant_getStatLevel(statValue);
+
+    return level < PLANT_STATUS_LEVEL_COUNT ? level : PLANT_STATUS_LEVEL_COUNT - 1;
+}
+
+/// Adds the stats of a plant to `stats`, or takes them out with a `sign` of -1
+static void countStats(PlantStoreStats *stats,
+    int sign,
+    PlantStat mediumHydration,
+    PlantStat hydration,
+    PlantStat nutrition,
+    PlantStat health) {
+    stats->countByHealthLevel[getStatsLevel(health)] += sign;
+    stats->countByWaterLevel[getStatsLevel(mediumHydration)] += sign;
+    stats->healthSum += sign * health;
+    stats->hydrationSum += sign * hydration;
+    stats->nutritionSum += sign * nutrition;
+}
+
+static void countPlant(PlantStoreStats *stats, int sign, const Plant *plant) {
+    stats->count += sign;
+    stats->countByType[plant->type] += sign;
+    stats->infectedCount += sign * plant->infected;
+    countStats(
+        stats, sign, plant->mediumHydration, plant->hydration, plant->nutrition, plant->health);
+}
+
+static void atomicAdd(int *value, int delta) {
+    if (delta != 0) {
+        __atomic_fetch_add(value, delta, __ATOMIC_RELAXED);
+    }
+}
+
+static void atomicAddLong(long long *value, long long delta) {
+    if (delta != 0) {
+        __atomic_fetch_add(value, delta, __ATOMIC_RELAXED);
+    }
+}
+
+static void addStats(PlantStoreStats *stats, const PlantStoreStats *delta) {
+    atomicAdd(&stats->count, delta->count);
+
+    for (int i = 0; i < PLANT_TYPE_COUNT; i++) {
+        atomicAdd(&stats->countByType[i], delta->countByType[i]);
+    }
+
+    for (int i = 0; i < PLANT_STATUS_LEVEL_COUNT; i++) {
+        atomicAdd(&stats->countByHealthLevel[i], delta->countByHealthLevel[i]);
+        atomicAdd(&stats->countByWaterLevel[i], delta->countByWaterLevel[i]);
+    }
+
+    atomicAdd(&stats->infectedCount, delta->infectedCount);
+    atomicAddLong(&stats->healthSum, delta->healthSum);
+    atomicAddLong(&stats->hydrationSum, delta->hydrationSum);
+    atomicAddLong(&stats->nutritionSum, delta->nutritionSum);
+}
+
+/// Average in points of the stat of `sum` (i.e. `stats->healthSum`), 0 without plants
+float plantStore_getAverageStat(const PlantStoreStats *stats, long long sum) {
+    if (stats->count == 0) {
+        return 0;
+    }
+
+    return (float)sum / stats->count / PLANT_STAT_ONE;
+}
+
+// State hash: a write only marks the plant, with a byte of its own so parallel jobs don't share
+// anything, and the plants marked since the last time are hashed again when the hash is asked for.
+// Each one XORs the hash it had and the new one into the hash of the store, so the cost is of the
+// plants that changed, and nothing is hashed if nobody asks. The traits are left out, they come
+// from the genome
+
+static uint64_t hashStoredPlant(const PlantStore *store, int plantId) {
+    if (!store->exists[plantId]) {
+        return 0;
+    }
+
+    uint64_t words[] = {
+        plantId | (uint64_t)store->type[plantId] << 16
+            | (uint64_t)(uint32_t)store->ticksCount[plantId] << 32,
+        store->mediumHydration[plantId] | (uint64_t)store->mediumNutrition[plantId] << 16
+            | (uint64_t)store->hydration[plantId] << 32 | (uint64_t)store->nutrition[plantId] << 48,
+        store->health[plantId] | (uint64_t)store->genome[plantId] << 16
+            | (uint64_t)(uint32_t)store->biomass[plantId] << 32,
+        store->infected[plantId] | (uint64_t)store->temperature[plantId] << 8
+            | (uint64_t)store->irrigation[plantId] << 16 | (uint64_t)store->light[plantId] << 24,
+    };
+
+    return utils_hashWords(words, sizeof(words) / sizeof(words[0]));
+}
+
+/// Hash of every field of every plant. Hashes again the plants written since the last call, so it
+/// can't run while the store is being written
+uint64_t plantStore_getHash(PlantStore *store) {
+    for (int plantId = 0; plantId < GARDEN_MAX_PLANTS; plantId++) {
+        if (!store->hashDirty[plantId]) {
+            continue;
+        }
+
+        uint64_t hash = hashStoredPlant(store, plantId);
+
+        store->hash ^= store->plantHash[plantId] ^ hash;
+        store->plantHash[plantId] = hash;
+        store->hashDirty[plantId] = false;
+    }
+
+    return store->hash;
+}
+
+// Level index: the same writes move the plant from the bit of its old level to the one of the new.
+// Plants of different jobs share words, so the bits are set and cleared with atomic ops too
+
+static PlantStat getIndexedStat(const Plant *plant, PlantStoreIndex index) {
+    switch (index) {
+    case PLANT_STORE_INDEX_HYDRATION:
+        return plant->hydration;
+    case PLANT_STORE_INDEX_NUTRITION:
+        return plant->nutrition;
+    case PLANT_STORE_INDEX_HEALTH:
+    case PLANT_STORE_INDEX_COUNT:
+        break;
+    }
+
+    return plant->health;
+}
+
+static void setBit(uint64_t *bits, int plantId) {
+    __atomic_fetch_or(&bits[plantId / 64], (uint64_t)1 << (plantId % 64), __ATOMIC_RELAXED);
+}
+
+static void clearBit(uint64_t *bits, int plantId) {
+    __atomic_fetch_and(&bits[plantId / 64], ~((uint64_t)1 << (plantId % 64)), __ATOMIC_RELAXED);
+}
+
+/// Moves the plant between the levels of `index`, -1 for none (a plant added or removed)
+static void moveInIndex(
+    PlantStore *store, PlantStoreIndex index, int plantId, int levelBefore, int levelAfter) {
+    if (levelBefore == levelAfter) {
+        return;
+    }
+
+    if (levelBefore != -1) {
+        clearBit(store->levelIndex[index][levelBefore], plantId);
+    }
+
+    if (levelAfter != -1) {
+        setBit(store->levelIndex[index][levelAfter], plantId);
+    }
+}
+
+/// Whether a plant with `nutrition` and `traits` is underfed, see PlantStore.underfed
+static bool isUnderfed(PlantStat nutrition, PlantTraits traits) {
+    return getStatsLevel(nutrition) < traits.optimalNutritionLevel;
+}
+
+/// Sets or clears the bit of the plant in PlantStore.underfed, if it changed
+static void setUnderfed(PlantStore *store, int plantId, bool before, bool after) {
+    if (before == after) {
+        return;
+    }
+
+    if (after) {
+        setBit(store->underfed, plantId);
+    } else {
+        clearBit(store->underfed, plantId);
+    }
+}
+
+/// Plants with a bit in any of the first `count` sets of `bits`
+static int countBits(const uint64_t (*bits)[PLANT_STORE_INDEX_WORDS], int count) {
+    int total = 0;
+
+    for (int set = 0; set < count; set++) {
+        for (int i = 0; i < PLANT_STORE_INDEX_WORDS; i++) {
+            total += __builtin_popcountll(bits[set][i]);
+        }
+    }
+
+    return total;
+}
+
+/// First plant id after `afterPlantId` with a bit in any of the first `count` sets of `bits`,
+/// going back to the start after the last plant. -1 if there is none
+static int findBit(const uint64_t (*bits)[PLANT_STORE_INDEX_WORDS], int count, int afterPlantId) {
+    int start = afterPlantId + 1;
+
+    // one word more than all of them, to get to the bits before `start` in its word
+    for (int i = 0; i <= PLANT_STORE_INDEX_WORDS; i++) {
+        int wordIndex = (start / 64 + i) % PLANT_STORE_INDEX_WORDS;
+        uint64_t word = 0;
+
+        for (int set = 0; set < count; set++) {
+            word |= bits[set][wordIndex];
+        }
+
+        if (i == 0 && start % 64 != 0) {
+            word &= ~(uint64_t)0 << (start % 64);
+        }
+
+        if (word != 0) {
+            return wordIndex * 64 + __builtin_ctzll(word);
+        }
+    }
+
+    return -1;
+}
+
+/// Plants with a level of `index` in [minLevel, maxLevel]
+int plantStore_countInLevels(
+    const PlantStore *store, PlantStoreIndex index, int minLevel, int maxLevel) {
+    return countBits(&store->levelIndex[index][minLevel], maxLevel - minLevel + 1);
+}
+
+/// First plant id after `afterPlantId` with a level of `index` in [minLevel, maxLevel], going
+/// back to the start after the last plant. -1 if there is none. Pass -1 to start from the first
+int plantStore_findInLevels(const PlantStore *store,
+    PlantStoreIndex index,
+    int minLevel,
+    int maxLevel,
+    int afterPlantId) {
+    return findBit(&store->levelIndex[index][minLevel], maxLevel - minLevel + 1, afterPlantId);
+}
+
+/// Plants with the nutrition below their optimal level
+int plantStore_countUnderfed(const PlantStore *store) {
+    return countBits(&store->underfed, 1);
+}
+
+/// First plant id after `afterPlantId` with the nutrition below its optimal level, the same way as
+/// plantStore_findInLevels
+int plantStore_findUnderfed(const PlantStore *store, int afterPlantId) {
+    return findBit(&store->underfed, 1, afterPlantId);
+}
+
+Plant plantStore_get(const PlantStore *store, int plantId) {
+    assert(plantId >= 0 && plantId < GARDEN_MAX_PLANTS);
+
+    return (Plant){
+        .type = store->type[plantId],
+        .exists = store->exists[plantId],
+        .mediumHydration = store->mediumHydration[plantId],
+        .mediumNutrition = store->mediumNutrition[plantId],
+        .hydration = store->hydration[plantId],
+        .nutrition = store->nutrition[plantId],
+        .health = store->health[plantId],
+        .biomass = store->biomass[plantId],
+        .genome = store->genome[plantId],
+        .traits = store->traits[plantId],
+        .infected = store->infected[plantId],
+        .temperature = store->temperature[plantId],
+        .light = store->light[plantId],
+        .irrigation = store->irrigation[plantId],
+        .ticksCount = store->ticksCount[plantId],
+    };
+}
+
+void plantStore_set(PlantStore *store, int plantId, const Plant *plant) {
+    assert(plantId >= 0 && plantId < GARDEN_MAX_PLANTS);
+
+    PlantStoreStats delta = {0};
+    Plant old = plantStore_get(store, plantId);
+
+    if (old.exists) {
+        countPlant(&delta, -1, &old);
+    }
+
+    if (plant->exists) {
+        countPlant(&delta, 1, plant);
+    }
+
+    addStats(&store->stats, &delta);
+
+    for (int index = 0; index < PLANT_STORE_INDEX_COUNT; index++) {
+        int levelBefore = old.exists ? getStatsLevel(getIndexedStat(&old, index)) : -1;
+        int levelAfter = plant->exists ? getStatsLevel(getIndexedStat(plant, index)) : -1;
+
+        moveInIndex(store, index, plantId, levelBefore, levelAfter);
+    }
+
+    setUnderfed(store,
+        plantId,
+        old.exists && isUnderfed(old.nutrition, old.traits),
+        plant->exists && isUnderfed(plant->nutrition, plant->traits));
+
+    store->type[plantId] = plant->type;
+    store->exists[plantId] = plant->exists;
+    store->mediumHydration[plantId] = plant->mediumHydration;
+    store->mediumNutrition[plantId] = plant->mediumNutrition;
+    store->hydration[plantId] = plant->hydration;
+    store->nutrition[plantId] = plant->nutrition;
+    store->health[plantId] = plant->health;
+    store->biomass[plantId] = plant->biomass;
+    store->genome[plantId] = plant->genome;
+    store->traits[plantId] = plant->traits;
+    store->infected[plantId] = plant->infected;
+    store->temperature[plantId] = plant->temperature;
+    store->light[plantId] = plant->light;
+    store->irrigation[plantId] = plant->irrigation;
+    store->ticksCount[plantId] = plant->ticksCount;
+    store->hashDirty[plantId] = true;
+}
+
+void plantStore_remove(PlantStore *store, int plantId) {
+    assert(plantId >= 0 && plantId < GARDEN_MAX_PLANTS);
+
+    if (!store->exists[plantId]) {
+        return;
+    }
+
+    PlantStoreStats delta = {0};
+    Plant old = plantStore_get(store, plantId);
+
+    countPlant(&delta, -1, &old);
+    addStats(&store->stats, &delta);
+
+    for (int index = 0; index < PLANT_STORE_INDEX_COUNT; index++) {
+        moveInIndex(store, index, plantId, getStatsLevel(getIndexedStat(&old, index)), -1);
+    }
+
+    setUnderfed(store, plantId, isUnderfed(old.nutrition, old.traits), false);
+
+    store->exists[plantId] = false;
+    store->hashDirty[plantId] = true;
+}
+
+/// Reference path: one plant at a time with plant_tick
+void plantStore_tickScalar(PlantStore *store, const int *plantIds, int count) {
+    for (int i = 0; i < count; i++) {
+        Plant plant = plantStore_get(store, plantIds[i]);
+
+        plant_tick(&plant);
+
+        plantStore_set(store, plantIds[i], &plant);
+    }
+}
+
+/// plant_advanceTicks for each plant of `plantIds`
+void plantStore_advanceTicks(PlantStore *store, const int *plantIds, int count, long ticks) {
+    for (int i = 0; i < count; i++) {
+        Plant plant = plantStore_get(store, plantIds[i]);
+
+        plant_advanceTicks(&plant, ticks);
+
+        plantStore_set(store, plantIds[i], &plant);
+    }
+}
+
+/// all the lanes set to `value`. Adding to a zero vector broadcasts it in a single instruction
+static i32xN splat(int value) {
+    i32xN zero = {0};
+
+    return zero + value;
+}
+
+/// `mask ? a : b` by lane
+static i32xN select(i32xN mask, i32xN a, i32xN b) {
+    return (mask & a) | (~mask & b);
+}
+
+/// same as clampStat of plant.c
+static i32xN clampStat(i32xN v) {
+    v = select(v < splat(0), splat(0), v);
+    return select(v > splat(PLANT_STAT_MAX), splat(PLANT_STAT_MAX), v);
+}
+
+/// same as plant_getStatLevel, counting the level tops below the stat (a true comparison is -1)
+/// instead of dividing, which has no vector instruction
+static i32xN getStatLevel(i32xN v) {
+    const int statPerLevel = PLANT_STAT_MAX / PLANT_STATUS_LEVEL_COUNT;
+    i32xN level = splat(0);
+
+    for (int i = 1; i <= PLANT_STATUS_LEVEL_COUNT; i++) {
+        level -= v >= splat(statPerLevel * i);
+    }
+
+    return level;
+}
+
+static i32xN absi(i32xN v) {
+    return select(v < splat(0), -v, v);
+}
+
+/// same as scaleByTime of plant.c
+static i32xN scaleByTime(i32xN rate, int deltaTime) {
+    return rate * deltaTime / PLANT_STAT_ONE;
+}
+
+/// Health change of one stat: +1 at the optimal level, -2 two levels away
+static i32xN getHealthChangeByDistance(i32xN distance) {
+    i32xN up = select(distance == splat(0), splat(PLANT_STAT(1)), splat(0));
+    i32xN down = select(distance == splat(2), splat(-PLANT_STAT(2)), splat(0));
+
+    return up + down;
+}
+
+typedef struct {
+    i32xN mediumHydration;
+    i32xN mediumNutrition;
+    i32xN hydration;
+    i32xN nutrition;
+    i32xN health;
+    i32xN biomass;
+} PlantLanes;
+
+/// PlantTraits, the infection, the temperature, the light and the irrigation by lane, they don't
+/// change with the ticks
+typedef struct {
+    i32xN optimalWaterLevel;
+    i32xN optimalNutritionLevel;
+    i32xN droughtResilience;
+    i32xN infected;
+    i32xN temperature;
+    i32xN light;
+    i32xN irrigation;
+} PlantTraitLanes;
+
+static void tickLanes(PlantLanes *p, const PlantTraitLanes *traits, int deltaTime) {
+    const int optimalHydrationLevel = PLANT_OPTIMAL_HYDRATION_LEVEL;
+
+    // Health change based on hydration and nutrition
+    const i32xN hydrationLevel = getStatLevel(p->hydration);
+    const i32xN nutritionLevel = getStatLevel(p->nutrition);
+
+    i32xN healthChange = splat(0);
+    healthChange += getHealthChangeByDistance(absi(optimalHydrationLevel - hydrationLevel));
+    healthChange += select(hydrationLevel == splat(optimalHydrationLevel - 2),
+        traits->droughtResilience * PLANT_STAT_ONE / 2,
+        splat(0));
+    healthChange
+        += getHealthChangeByDistance(absi(traits->optimalNutritionLevel - nutritionLevel));
+    healthChange -= select(traits->infected != splat(0), splat(PLANT_STAT(1)), splat(0));
+
+    p->health += scaleByTime(healthChange, deltaTime);
+
+    // Hydration change based on hydration medium
+    const i32xN mediumHydrationLevel = getStatLevel(p->mediumHydration);
+    const i32xN mediumWaterLevelDistanceFromOptimal
+        = traits->optimalWaterLevel - mediumHydrationLevel;
+    const i32xN inOptimalMedium = mediumWaterLevelDistanceFromOptimal == splat(0);
+    const i32xN hydrationBelowMedium = p->hydration < p->mediumHydration;
+
+    // if it likes saturated medium it can never be over watered
+    const i32xN likesSaturated = traits->optimalWaterLevel == splat(4);
+
+    i32xN optimalMediumChange = select(likesSaturated,
+        splat(PLANT_STAT(1)),
+        select(hydrationBelowMedium, splat(PLANT_STAT(2)), splat(-PLANT_STAT(2))));
+
+    i32xN capped = likesSaturated & inOptimalMedium & (nutritionLevel > splat(2));
+    p->hydration = select(capped, splat(PLANT_HYDRATION_RESET), p->hydration);
+
+    i32xN otherMediumChange = select((mediumHydrationLevel == splat(0)) & hydrationBelowMedium,
+        splat(PLANT_STAT(1)),
+        -mediumWaterLevelDistanceFromOptimal * PLANT_STAT_ONE);
+
+    i32xN hydrationChange = select(inOptimalMedium, optimalMediumChange, otherMediumChange);
+
+    p->hydration += scaleByTime(hydrationChange, deltaTime);
+
+    // Medium hydration change based on own level and plant hydration change
+    i32xN hydrationLoss = absi(hydrationChange) / 2;
+    hydrationLoss += select(mediumHydrationLevel > splat(2),
+        (mediumHydrationLevel - 2) * PLANT_STAT_ONE,
+        splat(0));
+    hydrationLoss += select(
+        traits->temperature == splat(PLANT_TEMPERATURE_HOT), splat(PLANT_STAT(1)), splat(0));
+
+    // Drippers
+    i32xN irrigation = traits->irrigation * PLANT_STAT_ONE / 2;
+
+    p->mediumHydration += scaleByTime(irrigation - hydrationLoss, deltaTime);
+
+    // Nutrition change based on nutrition medium
+    const i32xN mediumNutritionLevel = getStatLevel(p->mediumNutrition);
+    const i32xN healthLevel = getStatLevel(p->health);
+
+    i32xN emptyMediumChange = -healthLevel * PLANT_STAT_ONE / 2;
+
+    i32xN feedingChange = healthLevel / 2 + 1 + mediumNutritionLevel / 2;
+    i32xN mediumNutritionAvailable = p->mediumNutrition / PLANT_STAT_ONE;
+    feedingChange = select(mediumNutritionAvailable < feedingChange,
+        mediumNutritionAvailable,
+        feedingChange);
+
+    i32xN nutritionChange = select(p->mediumNutrition == splat(0),
+        emptyMediumChange,
+        feedingChange * PLANT_STAT_ONE);
+
+    p->nutrition += scaleByTime(nutritionChange, deltaTime);
+
+    p->mediumNutrition -= scaleByTime(absi(nutritionChange) / 2, deltaTime);
+
+    // Growth based on health and hydration
+    i32xN growth = select(healthLevel >= splat(PLANT_HEALTH_LEVEL_THRIVING),
+        splat(PLANT_STAT(1)),
+        select(healthLevel == splat(PLANT_HEALTH_LEVEL_HEALTHY),
+            splat(PLANT_STAT_ONE / 2),
+            select(healthLevel <= splat(PLANT_HEALTH_LEVEL_DYING),
+                splat(-PLANT_STAT_ONE / 2),
+                splat(0))));
+
+    growth -= select((growth > splat(0)) & (hydrationLevel != splat(optimalHydrationLevel)),
+        splat(PLANT_STAT_ONE / 2),
+        splat(0));
+    growth -= select((growth > splat(0)) & (traits->light == splat(PLANT_LIGHT_PARTIAL)),
+        splat(PLANT_STAT_ONE / 2),
+        splat(0));
+    growth = select((growth > splat(0))
+            & ((traits->temperature == splat(PLANT_TEMPERATURE_COLD))
+                | (traits->light == splat(PLANT_LIGHT_SHADE))),
+        splat(0),
+        growth);
+
+    p->biomass += scaleByTime(growth, deltaTime);
+
+    p->health = clampStat(p->health);
+    p->hydration = clampStat(p->hydration);
+    p->nutrition = clampStat(p->nutrition);
+    p->mediumHydration = clampStat(p->mediumHydration);
+    p->mediumNutrition = clampStat(p->mediumNutrition);
+    p->biomass = select(p->biomass < splat(0), splat(0), p->biomass);
+    p->biomass
+        = select(p->biomass > splat(PLANT_BIOMASS_MAX), splat(PLANT_BIOMASS_MAX), p->biomass);
+}
+
+/// getStatsLevel by lane, without the compares of getStatLevel: a level is 5 steps of 1024 units,
+/// and the steps are divided by 5 with a multiply and a shift, exact for any stat
+static i32xN getStatsLevelLanes(i32xN v) {
+    _Static_assert(PLANT_STAT_MAX / PLANT_STATUS_LEVEL_COUNT == 5 * 1024, "level of 5120 units");
+
+    i32xN level = ((v >> 10) * 205) >> 10;
+
+    return select(level > splat(PLANT_STATUS_LEVEL_COUNT - 1),
+        splat(PLANT_STATUS_LEVEL_COUNT - 1),
+        level);
+}
+
+/// What a tick of the lanes of `mask` (-1 for the lanes in use), the plants of `ids`, changes in
+/// the aggregates and the level index. The sums are kept by lane in `sums` and the levels, that
+/// rarely change, are moved one plant at a time
+static void countTickLanes(PlantStore *store,
+    PlantStoreStats *delta,
+    i32xN sums[3],
+    const int *ids,
+    const PlantLanes *before,
+    const PlantLanes *after,
+    i32xN mask) {
+    sums[0] += (after->health - before->health) & mask;
+    sums[1] += (after->hydration - before->hydration) & mask;
+    sums[2] += (after->nutrition - before->nutrition) & mask;
+
+    i32xN healthLevelBefore = getStatsLevelLanes(before->health);
+    i32xN healthLevelAfter = getStatsLevelLanes(after->health);
+    i32xN waterLevelBefore = getStatsLevelLanes(before->mediumHydration);
+    i32xN waterLevelAfter = getStatsLevelLanes(after->mediumHydration);
+    i32xN hydrationLevelBefore = getStatsLevelLanes(before->hydration);
+    i32xN hydrationLevelAfter = getStatsLevelLanes(after->hydration);
+    i32xN nutritionLevelBefore = getStatsLevelLanes(before->nutrition);
+    i32xN nutritionLevelAfter = getStatsLevelLanes(after->nutrition);
+    i32xN changed = (healthLevelBefore != healthLevelAfter) | (waterLevelBefore != waterLevelAfter)
+                  | (hydrationLevelBefore != hydrationLevelAfter)
+                  | (nutritionLevelBefore != nutritionLevelAfter);
+
+    changed &= mask;
+
+    for (int i = 0; i < PLANT_KERNEL_LANES; i++) {
+        if (!changed[i]) {
+            continue;
+        }
+
+        delta->countByHealthLevel[healthLevelBefore[i]]--;
+        delta->countByHealthLevel[healthLevelAfter[i]]++;
+        delta->countByWaterLevel[waterLevelBefore[i]]--;
+        delta->countByWaterLevel[waterLevelAfter[i]]++;
+
+        moveInIndex(store,
+            PLANT_STORE_INDEX_HYDRATION,
+            ids[i],
+            hydrationLevelBefore[i],
+            hydrationLevelAfter[i]);
+        moveInIndex(store,
+            PLANT_STORE_INDEX_NUTRITION,
+            ids[i],
+            nutritionLevelBefore[i],
+            nutritionLevelAfter[i]);
+        moveInIndex(
+            store, PLANT_STORE_INDEX_HEALTH, ids[i], healthLevelBefore[i], healthLevelAfter[i]);
+
+        // the traits don't change with the ticks, only the nutrition level can move the plant
+        int optimalNutritionLevel = store->traits[ids[i]].optimalNutritionLevel;
+        setUnderfed(store,
+            ids[i],
+            nutritionLevelBefore[i] < optimalNutritionLevel,
+            nutritionLevelAfter[i] < optimalNutritionLevel);
+    }
+}
+
+/// Ticks the plants of `plantIds`, that must all be of species `type`, PLANT_KERNEL_LANES at a
+/// time. Gives the same results as plantStore_tickScalar
+void plantStore_tick(PlantStore *store, enum PlantType type, const int *plantIds, int count) {
+    const PlantDefinition *props = &plantDefinitions[type];
+    PlantStoreStats delta = {0};
+    i32xN sums[3] = {};
+    i32xN laneIndex;
+
+    for (int i = 0; i < PLANT_KERNEL_LANES; i++) {
+        laneIndex[i] = i;
+    }
+
+    for (int first = 0; first < count; first += PLANT_KERNEL_LANES) {
+        int lanes = count - first;
+        if (lanes > PLANT_KERNEL_LANES) {
+            lanes = PLANT_KERNEL_LANES;
+        }
+
+        const int *ids = &plantIds[first];
+        PlantLanes p = {};
+        PlantTraitLanes traits = {};
+
+        for (int i = 0; i < lanes; i++) {
+            assert(store->type[ids[i]] == type);
+
+            traits.optimalWaterLevel[i] = store->traits[ids[i]].optimalWaterLevel;
+            traits.optimalNutritionLevel[i] = store->traits[ids[i]].optimalNutritionLevel;
+            traits.droughtResilience[i] = store->traits[ids[i]].droughtResilience;
+            traits.infected[i] = store->infected[ids[i]];
+            traits.temperature[i] = store->temperature[ids[i]];
+            traits.light[i] = store->light[ids[i]];
+            traits.irrigation[i] = store->irrigation[ids[i]];
+
+            p.mediumHydration[i] = store->mediumHydration[ids[i]];
+            p.mediumNutrition[i] = store->mediumNutrition[ids[i]];
+            p.hydration[i] = store->hydration[ids[i]];
+            p.nutrition[i] = store->nutrition[ids[i]];
+            p.health[i] = store->health[ids[i]];
+            p.biomass[i] = store->biomass[ids[i]];
+        }
+
+        PlantLanes before = p;
+
+        tickLanes(&p, &traits, props->secondsPerTick * PLANT_STAT_ONE);
+        countTickLanes(store, &delta, sums, ids, &before, &p, laneIndex < splat(lanes));
+
+        for (int i = 0; i < lanes; i++) {
+            store->mediumHydration[ids[i]] = p.mediumHydration[i];
+            store->mediumNutrition[ids[i]] = p.mediumNutrition[i];
+            store->hydration[ids[i]] = p.hydration[i];
+            store->nutrition[ids[i]] = p.nutrition[i];
+            store->health[ids[i]] = p.health[i];
+            store->biomass[ids[i]] = p.biomass[i];
+            store->ticksCount[ids[i]]++;
+            store->hashDirty[ids[i]] = true;
+        }
+    }
+
+    for (int i = 0; i < PLANT_KERNEL_LANES; i++) {
+        delta.healthSum += sums[0][i];
+        delta.hydrationSum += sums[1][i];
+        delta.nutritionSum += sums[2][i];
+    }
+
+    addStats(&store->stats, &delta);
+}
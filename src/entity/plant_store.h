@@ -0,0 +1,89 @@
+#pragma once
+
+#include "plant.h"
+#include "planter.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Garden-wide aggregates of the plants in the store, for dashboards and HUDs. Every write to the
+/// store keeps them up to date, so reading them is O(1) however many plants there are. They are
+/// of the stats as stored, which can be a bit behind (see the LOD tiers in garden.c). In
+/// PLANT_SIMULATION_EVENTS the plants are stored when their levels change, so the counts by level
+/// are right but the sums are of the last update of each plant
+typedef struct {
+    int count;
+    int countByType[PLANT_TYPE_COUNT];
+    /// by PlantHealthLevel, a full health counts as PLANT_HEALTH_LEVEL_THRIVING
+    int countByHealthLevel[PLANT_STATUS_LEVEL_COUNT];
+    /// by PlantWaterLevel of the soil
+    int countByWaterLevel[PLANT_STATUS_LEVEL_COUNT];
+    /// plants with the disease, see DiseaseGrid
+    int infectedCount;
+    /// sums of the stats, in PlantStat units, for the averages
+    long long healthSum;
+    long long hydrationSum;
+    long long nutritionSum;
+} PlantStoreStats;
+
+/// Stats the plants are indexed by level, see PlantStore.levelIndex
+typedef enum {
+    PLANT_STORE_INDEX_HYDRATION,
+    PLANT_STORE_INDEX_NUTRITION,
+    PLANT_STORE_INDEX_HEALTH,
+    PLANT_STORE_INDEX_COUNT,
+} PlantStoreIndex;
+
+#define PLANT_STORE_INDEX_WORDS ((GARDEN_MAX_PLANTS + 63) / 64)
+
+/// Plants of the whole garden, by plant id. The stats touched on every tick are kept in their own
+/// contiguous arrays so the update kernel can work on several plants at once. Use `Plant` (with
+/// `plantStore_get`/`plantStore_set`) to read or change a single plant
+typedef struct {
+    enum PlantType type[GARDEN_MAX_PLANTS];
+    bool exists[GARDEN_MAX_PLANTS];
+    int ticksCount[GARDEN_MAX_PLANTS];
+    PlantStat mediumHydration[GARDEN_MAX_PLANTS];
+    PlantStat mediumNutrition[GARDEN_MAX_PLANTS];
+    PlantStat hydration[GARDEN_MAX_PLANTS];
+    PlantStat nutrition[GARDEN_MAX_PLANTS];
+    PlantStat health[GARDEN_MAX_PLANTS];
+    int biomass[GARDEN_MAX_PLANTS];
+    PlantGenome genome[GARDEN_MAX_PLANTS];
+    PlantTraits traits[GARDEN_MAX_PLANTS];
+    bool infected[GARDEN_MAX_PLANTS];
+    PlantTemperature temperature[GARDEN_MAX_PLANTS];
+    PlantLight light[GARDEN_MAX_PLANTS];
+    uint8_t irrigation[GARDEN_MAX_PLANTS];
+    PlantStoreStats stats;
+    /// the plants in each level of each indexed stat, a bit by plant id (full stats are in the top
+    /// level). Kept up to date by every write like the aggregates, to find i.e. the dry plants
+    /// without looking at all of them
+    uint64_t levelIndex[PLANT_STORE_INDEX_COUNT][PLANT_STATUS_LEVEL_COUNT][PLANT_STORE_INDEX_WORDS];
+    /// the plants with the nutrition below the optimal level of their traits, a bit by plant id.
+    /// The level index can't tell them, the optimal level is of each plant (see PlantGenome)
+    uint64_t underfed[PLANT_STORE_INDEX_WORDS];
+    /// hash of every field of each plant (0 for the ones that don't exist) and all of them XORed,
+    /// as of the last plantStore_getHash. The plants written since then are marked in `hashDirty`
+    bool hashDirty[GARDEN_MAX_PLANTS];
+    uint64_t plantHash[GARDEN_MAX_PLANTS];
+    uint64_t hash;
+} PlantStore;
+
+void plantStore_init(PlantStore *store);
+Plant plantStore_get(const PlantStore *store, int plantId);
+void plantStore_set(PlantStore *store, int plantId, const Plant *plant);
+void plantStore_remove(PlantStore *store, int plantId);
+float plantStore_getAverageStat(const PlantStoreStats *stats, long long sum);
+int plantStore_countInLevels(
+    const PlantStore *store, PlantStoreIndex index, int minLevel, int maxLevel);
+int plantStore_findInLevels(const PlantStore *store,
+    PlantStoreIndex index,
+    int minLevel,
+    int maxLevel,
+    int afterPlantId);
+int plantStore_countUnderfed(const PlantStore *store);
+int plantStore_findUnderfed(const PlantStore *store, int afterPlantId);
+void plantStore_tick(PlantStore *store, enum PlantType type, const int *plantIds, int count);
+void plantStore_tickScalar(PlantStore *store, const int *plantIds, int count);
+void plantStore_advanceTicks(PlantStore *store, const int *plantIds, int count, long ticks);
+uint64_t plantStore_getHash(PlantStore *store);
@@ -1,10 +1,8 @@
 #include "planter.h"
-#include "../core/asset_manager.h"
 #include "../game/constants.h"
 #include "../game/scenes/scene.h"
 #include "../utils/utils.h"
 #include <assert.h>
-#include <raylib.h>
 
 const PlanterDefinition planterDefinitions[PLANTER_TYPE_COUNT] = {
     [PLANTER_TYPE_NORMAL] = {
@@ -37,31 +35,10 @@ const PlanterDefinition planterDefinitions[PLANTER_TYPE_COUNT] = {
         .plantBasePosY = 0,
         .cols = 0,
         .rows = 0,
+        .covers = true,
     },
 };
 
-static Vector3 getIsoDimensions(PlanterType planterType, Rotation rotation) {
-    Vector2 size = planterDefinitions[planterType].size;
-    float height = planterDefinitions[planterType].spriteExtraHeight;
-
-    utils_rotateVector(&size, rotation);
-
-    return (Vector3){
-        (size.x + size.y) * TILE_WIDTH / 2,
-        (size.x + size.y) * TILE_HEIGHT / 2,
-        height * TILE_HEIGHT,
-    };
-}
-
-static Vector2 getSpriteDimensions(PlanterType type, Rotation rotation) {
-    Vector3 dimensions = getIsoDimensions(type, rotation);
-
-    return (Vector2){
-        dimensions.x,
-        dimensions.y + dimensions.z,
-    };
-}
-
 /// internal plant grid of the planter
 static TileGrid getGrid(PlanterType planterType, Rotation rotation, int worldTileWidth) {
     Vector2 dimensions = planter_getFootPrint(planterType, rotation);
@@ -115,11 +92,6 @@ void planter_init(
     planter->rotation = rotation;
     planter->coords = coords;
     planter->plantGrid = getGrid(type, rotation, tileWidth);
-
-    int plantCount = planter->plantGrid.tileCount;
-    for (int i = 0; i < plantCount; i++) {
-        planter->plants[i].exists = false;
-    }
 }
 
 int planter_getPlantIndexFromGridCoords(Planter *planter, Vector2 coords) {
@@ -184,64 +156,3 @@ Vector2 planter_getPlantDrawOrigin(Planter *planter, int plantIndex) {
 
     return isoRec.bottom;
 }
-
-void planter_addPlant(Planter *planter, int index, enum PlantType type) {
-    if (planter->plants[index].exists) {
-        return;
-    }
-
-    plant_init(&planter->plants[index], type);
-}
-
-Rectangle planter_getSpriteSourceRec(
-    PlanterType type, Rotation planterRotation, Rotation viewRotation) {
-
-    Rotation finalRotation = utils_rotate(planterRotation, viewRotation);
-    Vector2 spriteDimensions = getSpriteDimensions(type, finalRotation);
-
-    float planterOriginY = 0;
-
-    for (int i = 0; i < PLANTER_TYPE_COUNT; i++) {
-        if (i == type) {
-            break;
-        }
-
-        Vector2 d = getSpriteDimensions(i, finalRotation);
-
-        planterOriginY += d.y;
-    }
-
-    Vector2 spriteOrigin = (Vector2){
-        finalRotation * spriteDimensions.x,
-        planterOriginY,
-    };
-
-    Rectangle source = {
-        spriteOrigin.x,
-        spriteOrigin.y,
-        spriteDimensions.x,
-        spriteDimensions.y,
-    };
-
-    return source;
-}
-
-void planter_draw(
-    Planter *planter, Vector2 origin, float scale, Rotation viewRotation, Color color) {
-
-    Rectangle source = planter_getSpriteSourceRec(planter->type, planter->rotation, viewRotation);
-
-    Rectangle dest = {
-        origin.x,
-        origin.y,
-        source.width * scale,
-        source.height * scale,
-    };
-
-    Vector3 isoDimensions
-        = getIsoDimensions(planter->type, utils_rotate(planter->rotation, viewRotation));
-
-    Vector2 pivot = {0, isoDimensions.z * scale};
-
-    DrawTexturePro(planterAtlas, source, dest, pivot, 0, color);
-}
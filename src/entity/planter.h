@@ -1,13 +1,17 @@
 #pragma once
 
+#include "../game/constants.h"
 #include "../game/gameplay.h"
 #include "../utils/grid.h"
+#include "../utils/raylib_types.h"
 #include "plant.h"
-#include <raylib.h>
 
 // 3x3 o 2x4 maximo por ahora
 #define PLANTER_MAX_PLANTS 9
 
+// Plants are identified garden-wide by `planterIndex * PLANTER_MAX_PLANTS + plantIndex`
+#define GARDEN_MAX_PLANTS (GARDEN_MAX_TILES * PLANTER_MAX_PLANTS)
+
 typedef enum {
     PLANTER_TYPE_NORMAL,
     PLANTER_TYPE_1x2,
@@ -26,6 +30,8 @@ typedef struct {
     /// plant griddimensions
     int cols;
     int rows;
+    /// furniture with a top, that covers its tiles from the rain and the sun (see Garden.covered)
+    bool covers;
 } PlanterDefinition;
 
 extern const PlanterDefinition planterDefinitions[PLANTER_TYPE_COUNT];
@@ -33,7 +39,6 @@ extern const PlanterDefinition planterDefinitions[PLANTER_TYPE_COUNT];
 typedef struct Planter {
     PlanterType type;
     bool exists;
-    Plant plants[PLANTER_MAX_PLANTS];
     TileGrid plantGrid;
     Vector2 coords;
     Rotation rotation;
@@ -46,8 +51,6 @@ void planter_empty(Planter *planter);
 void planter_init(
     Planter *planter, PlanterType type, Vector2 coords, Rotation rotation, int tileWidth);
 
-void planter_addPlant(Planter *planter, int index, enum PlantType type);
-
 Rectangle planter_getSpriteSourceRec(
     PlanterType type, Rotation planterRotation, Rotation viewRotation);
 
@@ -0,0 +1,80 @@
+#include "planter.h"
+#include "../core/asset_manager.h"
+#include "../game/constants.h"
+#include "../utils/utils.h"
+#include <raylib.h>
+
+static Vector3 getIsoDimensions(PlanterType planterType, Rotation rotation) {
+    Vector2 size = planterDefinitions[planterType].size;
+    float height = planterDefinitions[planterType].spriteExtraHeight;
+
+    utils_rotateVector(&size, rotation);
+
+    return (Vector3){
+        (size.x + size.y) * TILE_WIDTH / 2,
+        (size.x + size.y) * TILE_HEIGHT / 2,
+        height * TILE_HEIGHT,
+    };
+}
+
+static Vector2 getSpriteDimensions(PlanterType type, Rotation rotation) {
+    Vector3 dimensions = getIsoDimensions(type, rotation);
+
+    return (Vector2){
+        dimensions.x,
+        dimensions.y + dimensions.z,
+    };
+}
+
+Rectangle planter_getSpriteSourceRec(
+    PlanterType type, Rotation planterRotation, Rotation viewRotation) {
+
+    Rotation finalRotation = utils_rotate(planterRotation, viewRotation);
+    Vector2 spriteDimensions = getSpriteDimensions(type, finalRotation);
+
+    float planterOriginY = 0;
+
+    for (int i = 0; i < PLANTER_TYPE_COUNT; i++) {
+        if (i == type) {
+            break;
+        }
+
+        Vector2 d = getSpriteDimensions(i, finalRotation);
+
+        planterOriginY += d.y;
+    }
+
+    Vector2 spriteOrigin = (Vector2){
+        finalRotation * spriteDimensions.x,
+        planterOriginY,
+    };
+
+    Rectangle source = {
+        spriteOrigin.x,
+        spriteOrigin.y,
+        spriteDimensions.x,
+        spriteDimensions.y,
+    };
+
+    return source;
+}
+
+void planter_draw(
+    Planter *planter, Vector2 origin, float scale, Rotation viewRotation, Color color) {
+
+    Rectangle source = planter_getSpriteSourceRec(planter->type, planter->rotation, viewRotation);
+
+    Rectangle dest = {
+        origin.x,
+        origin.y,
+        source.width * scale,
+        source.height * scale,
+    };
+
+    Vector3 isoDimensions
+        = getIsoDimensions(planter->type, utils_rotate(planter->rotation, viewRotation));
+
+    Vector2 pivot = {0, isoDimensions.z * scale};
+
+    DrawTexturePro(planterAtlas, source, dest, pivot, 0, color);
+}
@@ -0,0 +1,62 @@
+#include "sun_path.h"
+#include <assert.h>
+#include <math.h>
+
+void sunPath_init(SunPath *path) {
+    for (int i = 0; i <= SUN_PATH_ARC_SAMPLES; i++) {
+        path->arc[i] = sinf((float)i / SUN_PATH_ARC_SAMPLES * M_PI);
+    }
+
+    for (int day = 0; day < DAYS_IN_A_YEAR; day++) {
+        // 1 at midsummer, -1 at midwinter
+        float season = cosf((float)(day - SUN_PATH_MIDSUMMER_DAY) / DAYS_IN_A_YEAR * 2 * M_PI);
+        float daylightHours = SUN_PATH_DAYLIGHT_HOURS + SUN_PATH_DAYLIGHT_SWING_HOURS * season;
+        float daylight = daylightHours / 24;
+
+        SunDay *sunDay = &path->days[day];
+
+        // noon is always at 12
+        sunDay->sunrise = 0.5f - daylight / 2;
+        sunDay->sunset = 0.5f + daylight / 2;
+        sunDay->daylightInverse = 1 / daylight;
+        sunDay->nightInverse = 1 / (1 - daylight);
+
+        // the sun is as much higher at noon as it is less low at midnight
+        sunDay->noonElevation = SUN_PATH_ELEVATION + SUN_PATH_ELEVATION_SWING * season;
+        sunDay->midnightElevation = -SUN_PATH_ELEVATION + SUN_PATH_ELEVATION_SWING * season;
+    }
+}
+
+/// Height of the arc `progress` of the way from a horizon to the other, from 0 to 1
+static float getArc(const SunPath *path, float progress) {
+    float sample = progress * SUN_PATH_ARC_SAMPLES;
+    int index = (int)sample;
+
+    if (index >= SUN_PATH_ARC_SAMPLES) {
+        return path->arc[SUN_PATH_ARC_SAMPLES];
+    }
+
+    float amount = sample - index;
+
+    return path->arc[index] + (path->arc[index + 1] - path->arc[index]) * amount;
+}
+
+/// `timeOfDay` in game seconds since midnight. By night the sun goes back under the horizon, from
+/// where it set to where it rises
+SunPosition sunPath_getPosition(const SunPath *path, int dayOfYear, float timeOfDay) {
+    assert(dayOfYear >= 0 && dayOfYear < DAYS_IN_A_YEAR);
+
+    const SunDay *day = &path->days[dayOfYear];
+    float dayPassed = timeOfDay / SECONDS_IN_A_DAY;
+
+    if (dayPassed >= day->sunrise && dayPassed < day->sunset) {
+        float progress = (dayPassed - day->sunrise) * day->daylightInverse;
+
+        return (SunPosition){progress, day->noonElevation * getArc(path, progress)};
+    }
+
+    float night = dayPassed >= day->sunset ? dayPassed - day->sunset : dayPassed + 1 - day->sunset;
+    float progress = night * day->nightInverse;
+
+    return (SunPosition){1 - progress, day->midnightElevation * getArc(path, progress)};
+}
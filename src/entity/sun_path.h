@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../game/game_clock.h"
+
+// Path of the sun over the garden through the day and the year. The days are longer and the sun
+// higher in the summer than in the winter. Everything with a sine is worked out once, in
+// sunPath_init: a row a day of the year with its sunrise, sunset and how high the sun gets, and
+// the shape of the arc from the horizon to the horizon. Where the sun is at a time is then a
+// lookup in both and a linear interpolation
+
+/// samples of the arc of the sun, from sunrise to sunset
+#define SUN_PATH_ARC_SAMPLES 32
+/// hours of daylight at the equinoxes, and how many more (or less) at the longest (or shortest) day
+#define SUN_PATH_DAYLIGHT_HOURS 12
+#define SUN_PATH_DAYLIGHT_SWING_HOURS 3
+/// elevation of the sun at noon at the equinoxes, and how much higher (or lower) at the longest (or
+/// shortest) day. 1 is as high as it gets
+#define SUN_PATH_ELEVATION 0.75f
+#define SUN_PATH_ELEVATION_SWING 0.25f
+/// the longest day: the middle of the summer
+#define SUN_PATH_MIDSUMMER_DAY (DAYS_IN_A_SEASON * SEASON_SUMMER + DAYS_IN_A_SEASON / 2)
+
+typedef struct {
+    /// in % of the day passed
+    float sunrise;
+    float sunset;
+    /// 1 over the daylight and the night, in % of the day
+    float daylightInverse;
+    float nightInverse;
+    /// elevation at noon, and below the horizon at midnight (negative)
+    float noonElevation;
+    float midnightElevation;
+} SunDay;
+
+typedef struct {
+    SunDay days[DAYS_IN_A_YEAR];
+    /// from 0 at the horizon to 1 halfway, with one more sample to interpolate the last one
+    float arc[SUN_PATH_ARC_SAMPLES + 1];
+} SunPath;
+
+typedef struct {
+    /// along the path: 0 at sunrise, 1 at sunset, and back to 0 under the horizon by night
+    float across;
+    /// over the horizon, negative under it
+    float elevation;
+} SunPosition;
+
+void sunPath_init(SunPath *path);
+SunPosition sunPath_getPosition(const SunPath *path, int dayOfYear, float timeOfDay);
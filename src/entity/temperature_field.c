@@ -0,0 +1,106 @@
+#include "temperature_field.h"
+#include <assert.h>
+#include <string.h>
+
+// as wide as the target allows, like the plant kernel (see plant_store.c). Every lane does the
+// same operations in the same order, so the results don't depend on the width
+#if defined(__AVX512F__)
+#define TEMPERATURE_FIELD_LANES 16
+#elif defined(__AVX__)
+#define TEMPERATURE_FIELD_LANES 8
+#else
+#define TEMPERATURE_FIELD_LANES 4
+#endif
+
+_Static_assert(TEMPERATURE_FIELD_STRIDE >= GARDEN_MAX_COLS + 1 + TEMPERATURE_FIELD_LANES,
+    "room for the last vector of a row");
+
+typedef float f32xN __attribute__((vector_size(TEMPERATURE_FIELD_LANES * sizeof(float))));
+
+/// the tiles aren't aligned to the vectors, as the stencil reads them one tile to each side
+static f32xN load(const float *tiles) {
+    f32xN v;
+    memcpy(&v, tiles, sizeof(v));
+
+    return v;
+}
+
+static void store(float *tiles, f32xN v) {
+    memcpy(tiles, &v, sizeof(v));
+}
+
+void temperatureField_init(TemperatureField *field, int cols, int rows, float temperature) {
+    assert(cols > 0 && cols <= GARDEN_MAX_COLS);
+    assert(rows > 0 && rows <= GARDEN_MAX_ROWS);
+
+    field->cols = cols;
+    field->rows = rows;
+    field->current = 0;
+
+    memset(field->temperature, 0, sizeof(field->temperature));
+    memset(field->exposure, 0, sizeof(field->exposure));
+
+    for (int y = 1; y <= rows; y++) {
+        for (int x = 1; x <= cols; x++) {
+            field->temperature[0][y][x] = temperature;
+            field->exposure[y][x] = 1;
+        }
+    }
+}
+
+void temperatureField_setExposure(TemperatureField *field, int x, int y, float exposure) {
+    assert(x >= 0 && x < field->cols && y >= 0 && y < field->rows);
+
+    field->exposure[y + 1][x + 1] = exposure;
+}
+
+float temperatureField_get(const TemperatureField *field, int x, int y) {
+    assert(x >= 0 && x < field->cols && y >= 0 && y < field->rows);
+
+    return field->temperature[field->current][y + 1][x + 1];
+}
+
+float temperatureField_getExposure(const TemperatureField *field, int x, int y) {
+    assert(x >= 0 && x < field->cols && y >= 0 && y < field->rows);
+
+    return field->exposure[y + 1][x + 1];
+}
+
+/// Sets the border around the tiles to the temperature of the air
+static void setBorder(TemperatureField *field, float grid[][TEMPERATURE_FIELD_STRIDE], float air) {
+    for (int x = 0; x <= field->cols + 1; x++) {
+        grid[0][x] = air;
+        grid[field->rows + 1][x] = air;
+    }
+
+    for (int y = 1; y <= field->rows; y++) {
+        grid[y][0] = air;
+        grid[y][field->cols + 1] = air;
+    }
+}
+
+/// One step with the sun at `sun` (0 at night, 1 at noon) and the air at `air` degrees
+void temperatureField_step(TemperatureField *field, float sun, float air) {
+    float(*from)[TEMPERATURE_FIELD_STRIDE] = field->temperature[field->current];
+    float(*to)[TEMPERATURE_FIELD_STRIDE] = field->temperature[1 - field->current];
+    const float heating = sun * TEMPERATURE_SUN_HEATING;
+
+    // the last vector of a row writes past the border, it is set again before every step
+    setBorder(field, from, air);
+
+    for (int y = 1; y <= field->rows; y++) {
+        for (int x = 1; x <= field->cols; x += TEMPERATURE_FIELD_LANES) {
+            f32xN t = load(&from[y][x]);
+            f32xN neighbors = load(&from[y][x - 1]) + load(&from[y][x + 1])
+                            + load(&from[y - 1][x]) + load(&from[y + 1][x]);
+
+            t += TEMPERATURE_DIFFUSION * (neighbors - 4 * t);
+            t += heating * load(&field->exposure[y][x]);
+            t -= TEMPERATURE_COOLING * (t - air);
+
+            store(&to[y][x], t);
+        }
+    }
+
+    field->current = 1 - field->current;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "../game/constants.h"
+
+// Temperature of the tiles, in degrees: the sun heats them by day, they cool down towards the air,
+// and the heat spreads to their neighbors. A step is a 5-point stencil over a float grid with a
+// border of one tile all around, the air around the garden, worked out several tiles at a time
+// with gcc vector extensions. It is double buffered: a step reads one grid and writes the other
+
+/// columns of a row of the grids: the tiles, the border, and room for the widest vectors to go
+/// past the last tile
+#define TEMPERATURE_FIELD_STRIDE (GARDEN_MAX_COLS + 2 + 16)
+
+/// share of the difference with each neighbor a tile takes in a step. Stable up to 0.25
+#define TEMPERATURE_DIFFUSION 0.1f
+/// degrees a step of full sun adds to a fully exposed tile
+#define TEMPERATURE_SUN_HEATING 0.75f
+/// share of the difference with the air a tile loses in a step
+#define TEMPERATURE_COOLING 0.05f
+
+typedef struct {
+    int cols;
+    int rows;
+    /// grid of `temperature` with the current state
+    int current;
+    /// tile (x, y) is at [y + 1][x + 1]
+    float temperature[2][GARDEN_MAX_ROWS + 2][TEMPERATURE_FIELD_STRIDE];
+    /// how much of the sun each tile gets, from 0 to 1. Same layout as `temperature`
+    float exposure[GARDEN_MAX_ROWS + 2][TEMPERATURE_FIELD_STRIDE];
+} TemperatureField;
+
+void temperatureField_init(TemperatureField *field, int cols, int rows, float temperature);
+void temperatureField_setExposure(TemperatureField *field, int x, int y, float exposure);
+float temperatureField_get(const TemperatureField *field, int x, int y);
+float temperatureField_getExposure(const TemperatureField *field, int x, int y);
+void temperatureField_step(TemperatureField *field, float sun, float air);
@@ -0,0 +1,74 @@
+#include "weather.h"
+#include "../utils/utils.h"
+#include <assert.h>
+
+static double getStateSeconds(Weather *weather) {
+    uint64_t random = utils_random(&weather->random);
+
+    return WEATHER_MIN_SECONDS + random % (WEATHER_MAX_SECONDS - WEATHER_MIN_SECONDS + 1);
+}
+
+/// Starts sunny
+void weather_init(Weather *weather, uint64_t seed) {
+    weather->random = seed;
+    weather->state = WEATHER_SUN;
+    weather->secondsLeft = getStateSeconds(weather);
+}
+
+/// Clouds come before and after the rain, and go away or turn into rain half of the times
+static WeatherState getNextState(Weather *weather) {
+    switch (weather->state) {
+    case WEATHER_SUN:
+    case WEATHER_RAIN:
+        return WEATHER_CLOUD;
+
+    case WEATHER_CLOUD:
+        return utils_random(&weather->random) & 1 ? WEATHER_RAIN : WEATHER_SUN;
+
+    case WEATHER_COUNT:
+        break;
+    }
+
+    assert(false);
+    return WEATHER_SUN;
+}
+
+/// Goes through the states of the next `deltaTime` seconds. Returns whether the state changed
+bool weather_update(Weather *weather, double deltaTime) {
+    WeatherState before = weather->state;
+
+    weather->secondsLeft -= deltaTime;
+
+    while (weather->secondsLeft <= 0) {
+        weather->state = getNextState(weather);
+        weather->secondsLeft += getStateSeconds(weather);
+    }
+
+    return weather->state != before;
+}
+
+/// Share of the sun that gets to the garden
+float weather_getSunShare(WeatherState state) {
+    switch (state) {
+    case WEATHER_CLOUD:
+        return 0.5f;
+    case WEATHER_RAIN:
+        return 0.25f;
+    default:
+        return 1;
+    }
+}
+
+const char *weather_getName(WeatherState state) {
+    switch (state) {
+    case WEATHER_SUN:
+        return "Sunny";
+    case WEATHER_CLOUD:
+        return "Cloudy";
+    case WEATHER_RAIN:
+        return "Raining";
+    default:
+        assert(false);
+        return "";
+    }
+}
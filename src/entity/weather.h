@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Weather of the garden: sun, clouds or rain, each for a while, on a schedule that only depends on
+// the seed. Clouds and rain let less sun through (see TemperatureField), and the rain waters the
+// plants out in the open, the ones whose planter isn't covered (see Garden.covered)
+
+typedef enum {
+    WEATHER_SUN,
+    WEATHER_CLOUD,
+    WEATHER_RAIN,
+    WEATHER_COUNT,
+} WeatherState;
+
+/// seconds of plant time a state lasts, at least and at most. A game hour is 180 of them
+#define WEATHER_MIN_SECONDS 180
+#define WEATHER_MAX_SECONDS 1080
+/// half points a second of water the rain gives the soil of a plant in the open, like the
+/// drippers (see IrrigationNetwork)
+#define WEATHER_RAIN_FLOW 4
+
+typedef struct {
+    WeatherState state;
+    /// seconds of plant time until the next state
+    double secondsLeft;
+    /// state of the random numbers of the schedule
+    uint64_t random;
+} Weather;
+
+void weather_init(Weather *weather, uint64_t seed);
+bool weather_update(Weather *weather, double deltaTime);
+float weather_getSunShare(WeatherState state);
+const char *weather_getName(WeatherState state);
@@ -1,3 +1,9 @@
+#pragma once
+
 #define WORLD_SCALE 4.0f
 #define TILE_WIDTH 32
 #define TILE_HEIGHT (int)(TILE_WIDTH / 2)
+
+#define GARDEN_MAX_COLS 20
+#define GARDEN_MAX_ROWS 20
+#define GARDEN_MAX_TILES (GARDEN_MAX_COLS * GARDEN_MAX_ROWS)
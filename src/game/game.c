@@ -3,6 +3,8 @@
 #include "../entity/garden.h"
 #include "../ui/ui.h"
 #include "gameplay.h"
+#include "sim_thread.h"
+#include <string.h>
 #include <raylib.h>
 
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
@@ -22,10 +24,11 @@ void game_init(Game *game) {
 
     game->gameplaySpeed = GAMEPLAY_SPEED_NORMAL;
     game->toolSelected = GARDENING_TOOL_NONE;
+    game->gameplayMode = GAMEPLAY_MODE_NORMAL;
     game->screenSize = screenSize;
     game->target = LoadRenderTexture(screenSize.x, screenSize.y);
     game->state = GAME_STATE_MAIN_MENU;
-    game->inGameSeconds = 0; // (23 * 60 * 60) + (60 * 59);
+    gameClock_init(&game->clock, 0); // (23 * 60 * 60 + 60 * 59) * GAME_CLOCK_TICKS_PER_SECOND
 
     for (int i = 0; i < GARDENING_TOOL_COUNT; i++) {
         game->toolVariantsSelection[i] = 0;
@@ -35,7 +38,14 @@ void game_init(Game *game) {
 
     SetTextureFilter(game->target.texture, TEXTURE_FILTER_BILINEAR);
 
-    garden_init(&game->garden, &game->screenSize, game->inGameSeconds);
+    garden_init(&game->garden,
+        &game->screenSize,
+        gameClock_getDayOfYear(&game->clock),
+        gameClock_getTimeOfDay(&game->clock));
+
+    simThread_start(&game->garden, &game->clock);
+    simThread_push((SimCommand){SIM_COMMAND_SET_SPEED, {.speed = game->gameplaySpeed}});
+    game->simView = garden_getView(&game->garden);
 
     ui_init(&game->ui, &screenSize, game->gameplaySpeed);
     keyMap_init(&game->keyMap);
@@ -60,27 +70,42 @@ void game_processInput(Game *game) {
     }
 }
 
+/// The sim LOD needs the view, which only changes with the input
+static void sendViewToSim(Game *game) {
+    GardenView view = garden_getView(&game->garden);
+
+    if (memcmp(&view, &game->simView, sizeof(GardenView)) != 0) {
+        game->simView = view;
+        simThread_push((SimCommand){SIM_COMMAND_SET_VIEW, {.view = view}});
+    }
+}
+
+/// The plants (and the clock) are simulated in the sim thread, see sim_thread.h. Here they are
+/// only picked from its last snapshot
 void game_update(Game *game, float deltaTime) {
     calculateScaleAndOffset(game);
 
-    // 1.0, 1.5, 3.0
-    const float speedFactor = (game->gameplaySpeed * game->gameplaySpeed + 2) * 0.5f;
-    deltaTime *= speedFactor;
-
     switch (game->state) {
     case GAME_STATE_MAIN_MENU:
         if (IsKeyPressed(KEY_SPACE)) {
             game->state = GAME_STATE_GARDEN;
+            simThread_push((SimCommand){SIM_COMMAND_SET_PAUSED, {.paused = false}});
         }
         break;
     case GAME_STATE_GARDEN:
-        game->inGameSeconds += GAME_SECONDS_PER_RL_SECONDS * deltaTime;
+        sendViewToSim(game);
+
+        long long dayBefore = gameClock_getDay(&game->clock);
+        simThread_readSnapshot(&game->garden, &game->clock);
 
-        if (game->inGameSeconds > SECONDS_IN_A_DAY) {
-            game->inGameSeconds = 0;
+        // a time-lapse can end more than a day in a frame
+        for (long long day = dayBefore; day < gameClock_getDay(&game->clock); day++) {
+            messages_dispatchMessage((Message){MESSAGE_EV_DAY_ENDED, {.selection = day}}, game);
         }
 
-        garden_update(&game->garden, deltaTime, game->inGameSeconds);
+        garden_updateLight(&game->garden,
+            gameClock_getDayOfYear(&game->clock),
+            gameClock_getTimeOfDay(&game->clock));
         break;
     }
 }
@@ -88,10 +113,14 @@ void game_update(Game *game, float deltaTime) {
 void drawGardenScene(Game *game) {
     ClearBackground((Color){100, 100, 100, 100});
 
-    garden_draw(&game->garden, game->toolSelected, game->toolVariantsSelection[game->toolSelected]);
+    garden_draw(&game->garden,
+        game->gameplayMode,
+        game->toolSelected,
+        game->toolVariantsSelection[game->toolSelected]);
 
     // For debug
     input_drawMousePos(&game->input, game->screenSize);
+    garden_drawLodCounters(&game->garden, game->screenSize);
 
     // UI must be at the end
     ui_draw(&game->ui,
@@ -99,7 +128,7 @@ void drawGardenScene(Game *game) {
         &game->screenSize,
         &game->garden,
         game->toolSelected,
-        game->inGameSeconds);
+        &game->clock);
 }
 
 void drawMainMenuScene(Game *game) {
@@ -152,3 +181,7 @@ void game_draw(Game *game) {
 
     EndDrawing();
 }
+
+void game_shutdown(Game *game) {
+    simThread_stop();
+}
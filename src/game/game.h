@@ -2,6 +2,7 @@
 
 #include "../input/key_map.h"
 #include "../ui/ui.h"
+#include "game_clock.h"
 #include "gameplay.h"
 #include <raylib.h>
 
@@ -19,12 +20,17 @@ typedef struct Game {
     float scale;
     Vector2 screenOffset;
     enum GardeningTool toolSelected;
+    enum GameplayMode gameplayMode;
     int toolVariantsSelection[GARDENING_TOOL_COUNT];
     GameplaySpeed gameplaySpeed;
-    float inGameSeconds;
+    /// clock of the last snapshot of the sim thread
+    GameClock clock;
+    /// the last view sent to the sim thread
+    GardenView simView;
 } Game;
 
 void game_init(Game *game);
 void game_processInput(Game *game);
 void game_update(Game *game, float deltaTime);
 void game_draw(Game *game);
+void game_shutdown(Game *game);
@@ -0,0 +1,66 @@
+#include "game_clock.h"
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+
+void gameClock_init(GameClock *clock, long long ticks) {
+    clock->ticks = ticks;
+    clock->tickFraction = 0;
+}
+
+/// Moves the clock `gameSeconds` forward. The fractions of a tick are carried to the next call, so
+/// many short steps add up to the same time as a long one
+void gameClock_advance(GameClock *clock, double gameSeconds) {
+    assert(gameSeconds >= 0);
+
+    double ticks = gameSeconds * GAME_CLOCK_TICKS_PER_SECOND + clock->tickFraction;
+    double wholeTicks = floor(ticks);
+
+    clock->ticks += (long long)wholeTicks;
+    clock->tickFraction = ticks - wholeTicks;
+}
+
+/// Days since the start, the first one is day 0
+long long gameClock_getDay(const GameClock *clock) {
+    return clock->ticks / GAME_CLOCK_TICKS_PER_DAY;
+}
+
+/// The first day of spring is 0
+int gameClock_getDayOfYear(const GameClock *clock) {
+    return gameClock_getDay(clock) % DAYS_IN_A_YEAR;
+}
+
+/// Seconds since midnight
+float gameClock_getTimeOfDay(const GameClock *clock) {
+    return (float)(clock->ticks % GAME_CLOCK_TICKS_PER_DAY) / GAME_CLOCK_TICKS_PER_SECOND;
+}
+
+/// The first day of a season is 0
+int gameClock_getDayOfSeason(const GameClock *clock) {
+    return gameClock_getDay(clock) % DAYS_IN_A_SEASON;
+}
+
+Season gameClock_getSeason(const GameClock *clock) {
+    return gameClock_getDay(clock) / DAYS_IN_A_SEASON % SEASON_COUNT;
+}
+
+/// Years since the start, the first one is year 0
+long long gameClock_getYear(const GameClock *clock) {
+    return gameClock_getDay(clock) / DAYS_IN_A_YEAR;
+}
+
+const char *gameClock_getSeasonName(Season season) {
+    switch (season) {
+    case SEASON_SPRING:
+        return "Spring";
+    case SEASON_SUMMER:
+        return "Summer";
+    case SEASON_AUTUMN:
+        return "Autumn";
+    case SEASON_WINTER:
+        return "Winter";
+    default:
+        assert(false);
+        return "";
+    }
+}
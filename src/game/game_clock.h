@@ -0,0 +1,37 @@
+#pragma once
+
+#include "gameplay.h"
+
+/// resolution of the clock: a tick is a millisecond of game time
+#define GAME_CLOCK_TICKS_PER_SECOND 1000
+#define GAME_CLOCK_TICKS_PER_DAY ((long long)SECONDS_IN_A_DAY * GAME_CLOCK_TICKS_PER_SECOND)
+
+#define DAYS_IN_A_SEASON 30
+
+typedef enum {
+    SEASON_SPRING,
+    SEASON_SUMMER,
+    SEASON_AUTUMN,
+    SEASON_WINTER,
+    SEASON_COUNT,
+} Season;
+
+#define DAYS_IN_A_YEAR (DAYS_IN_A_SEASON * SEASON_COUNT)
+
+/// Game time since the start of the game. Integer ticks, so it doesn't lose precision however
+/// long the game runs, and the same steps always give the same time
+typedef struct {
+    long long ticks;
+    /// part of a tick advanced but not counted yet, always in [0, 1)
+    double tickFraction;
+} GameClock;
+
+void gameClock_init(GameClock *clock, long long ticks);
+void gameClock_advance(GameClock *clock, double gameSeconds);
+long long gameClock_getDay(const GameClock *clock);
+int gameClock_getDayOfYear(const GameClock *clock);
+float gameClock_getTimeOfDay(const GameClock *clock);
+int gameClock_getDayOfSeason(const GameClock *clock);
+Season gameClock_getSeason(const GameClock *clock);
+long long gameClock_getYear(const GameClock *clock);
+const char *gameClock_getSeasonName(Season season);
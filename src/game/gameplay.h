@@ -4,12 +4,18 @@
 #define SECONDS_IN_A_DAY 86400            // seconds in a 24h day - 24*60*60
 #define GAME_SECONDS_PER_RL_SECONDS 20.0f // game seconds equivalent to a real second
 
+/// GAMEPLAY_MODE_IRRIGATION is while laying the irrigation: the garden shows the pipes and the
+/// flow of the drippers over the planters
 enum GameplayMode { GAMEPLAY_MODE_NORMAL, GAMEPLAY_MODE_IRRIGATION };
 
 typedef enum {
     GAMEPLAY_SPEED_NORMAL,
     GAMEPLAY_SPEED_FAST,
     GAMEPLAY_SPEED_FASTEST,
+    // time-lapses, to see the plants grow (or die) over days
+    GAMEPLAY_SPEED_TIMELAPSE_100,
+    GAMEPLAY_SPEED_TIMELAPSE_1000,
+    GAMEPLAY_SPEED_TIMELAPSE_10000,
     GAMEPLAY_SPEED_COUNT,
 } GameplaySpeed;
 
@@ -29,5 +35,23 @@ enum GardeningTool {
     GARDENING_TOOL_PLANTER,
     GARDENING_TOOL_PLANT_CUTTING,
     GARDENING_TOOL_TRASH_BIN,
+    GARDENING_TOOL_PRUNER,
+    /// lays the irrigation, its variants are the IrrigationPiece. Goes to GAMEPLAY_MODE_IRRIGATION
+    GARDENING_TOOL_IRRIGATION,
     GARDENING_TOOL_COUNT,
 };
+
+/// Variants of the irrigator and the nutrients: what a click waters or feeds
+typedef enum {
+    CARE_BRUSH_PLANT,
+    /// all the plants of the planter
+    CARE_BRUSH_PLANTER,
+    /// the planters in a square of tiles around the one clicked
+    CARE_BRUSH_SQUARE,
+    /// the planters in a circle of tiles around the one clicked
+    CARE_BRUSH_CIRCLE,
+    CARE_BRUSH_COUNT,
+} CareBrush;
+
+/// tiles from the one clicked to the edge of the square and circle brushes
+#define CARE_BRUSH_RADIUS 3
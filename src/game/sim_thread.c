@@ -0,0 +1,244 @@
+#include "sim_thread.h"
+#include <assert.h>
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+
+// Commands go through a ring with a single producer (the thread that draws) and a single consumer
+// (the sim thread): each side only moves its own end, so the two ends are all the sync needed.
+// Snapshots go through a triple buffer: the sim thread writes one, the drawing thread reads
+// another and the third is the last one published. Each side swaps its own with the published
+// one, so neither ever waits for the other
+
+/// set in `published` while its snapshot wasn't read
+#define SNAPSHOT_FRESH 4
+
+typedef struct {
+    GardenSnapshot garden;
+    GameClock clock;
+} SimSnapshot;
+
+typedef struct {
+    pthread_t thread;
+    atomic_bool running;
+    /// owned by the sim thread from the start
+    Garden garden;
+    GardenView view;
+    GameplaySpeed speed;
+    bool paused;
+    GameClock clock;
+    /// seconds of work per simulated second in the last step, for the work cap
+    double stepCost;
+
+    SimCommand commands[SIM_THREAD_COMMAND_CAPACITY];
+    /// next command to run, only moved by the sim thread
+    atomic_int commandsHead;
+    /// where the next command goes, only moved by the drawing thread
+    atomic_int commandsTail;
+
+    SimSnapshot snapshots[3];
+    /// only used by the sim thread
+    int writing;
+    /// only used by the drawing thread
+    int reading;
+    atomic_int published;
+} SimThread;
+
+static SimThread sim;
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void runCommand(const SimCommand *command) {
+    const SimCommandArgs *args = &command->args;
+
+    switch (command->type) {
+    case SIM_COMMAND_GARDEN:
+        garden_runCommand(&sim.garden, &args->garden);
+        break;
+
+    case SIM_COMMAND_SET_VIEW:
+        sim.view = args->view;
+        break;
+
+    case SIM_COMMAND_SET_SPEED:
+        sim.speed = args->speed;
+        break;
+
+    case SIM_COMMAND_SET_PAUSED:
+        sim.paused = args->paused;
+        break;
+    }
+}
+
+/// Returns how many commands were run
+static int runCommands() {
+    int head = atomic_load(&sim.commandsHead);
+    int tail = atomic_load(&sim.commandsTail);
+    int count = tail - head;
+
+    for (; head != tail; head++) {
+        runCommand(&sim.commands[head % SIM_THREAD_COMMAND_CAPACITY]);
+    }
+
+    atomic_store(&sim.commandsHead, head);
+
+    return count;
+}
+
+/// Simulated seconds per real second
+static double getSpeedFactor(GameplaySpeed speed) {
+    switch (speed) {
+    case GAMEPLAY_SPEED_NORMAL:
+        return 1;
+    case GAMEPLAY_SPEED_FAST:
+        return 1.5;
+    case GAMEPLAY_SPEED_FASTEST:
+        return 3;
+    case GAMEPLAY_SPEED_TIMELAPSE_100:
+        return 100;
+    case GAMEPLAY_SPEED_TIMELAPSE_1000:
+        return 1000;
+    case GAMEPLAY_SPEED_TIMELAPSE_10000:
+        return 10000;
+    default:
+        assert(false);
+        return 1;
+    }
+}
+
+// A step of any length is stable: the wheels catch up a turn at once and each plant jumps from
+// level change to level change (see plant_advanceTicks), so a time-lapse takes the same states a
+// plant would take at normal speed. What a step can't do is take any time, so the seconds
+// simulated in a step are capped to the ones the last step says fit in the budget. Normal speed
+// is never capped
+
+static void step(double realSeconds) {
+    double deltaTime = realSeconds * getSpeedFactor(sim.speed);
+
+    if (sim.stepCost > 0) {
+        double maxDeltaTime = fmax(realSeconds, SIM_THREAD_STEP_BUDGET_SECONDS / sim.stepCost);
+        deltaTime = fmin(deltaTime, maxDeltaTime);
+    }
+
+    gameClock_advance(&sim.clock, GAME_SECONDS_PER_RL_SECONDS * deltaTime);
+
+    double start = now();
+    garden_updatePlants(&sim.garden,
+        deltaTime,
+        gameClock_getDayOfYear(&sim.clock),
+        gameClock_getTimeOfDay(&sim.clock),
+        &sim.view);
+
+    if (deltaTime > 0) {
+        sim.stepCost = (now() - start) / deltaTime;
+    }
+}
+
+static void publish() {
+    SimSnapshot *snapshot = &sim.snapshots[sim.writing];
+
+    garden_writeSnapshot(&sim.garden, &snapshot->garden);
+    snapshot->clock = sim.clock;
+
+    int previous = atomic_exchange(&sim.published, sim.writing | SNAPSHOT_FRESH);
+    sim.writing = previous & ~SNAPSHOT_FRESH;
+}
+
+static void *simLoop(void *arg) {
+    double last = now();
+
+    while (atomic_load(&sim.running)) {
+        bool changed = runCommands() > 0;
+        double stepStart = now();
+
+        if (!sim.paused) {
+            step(stepStart - last);
+            changed = true;
+        }
+
+        last = stepStart;
+
+        if (changed) {
+            publish();
+        }
+
+        // sleep what is left of the step
+        double wait = SIM_THREAD_STEP_SECONDS - (now() - stepStart);
+
+        if (wait > 0) {
+            struct timespec ts = {0, wait * 1e9};
+            nanosleep(&ts, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+/// Starts simulating a copy of `garden`, paused. From now on the plants of `garden` (and of every
+/// garden it is copied to) are only changed with commands and read from the snapshots
+void simThread_start(const Garden *garden, const GameClock *clock) {
+    sim.garden = *garden;
+    sim.view = garden_getView(garden);
+    sim.speed = GAMEPLAY_SPEED_NORMAL;
+    sim.paused = true;
+    sim.clock = *clock;
+    sim.stepCost = 0;
+
+    atomic_init(&sim.commandsHead, 0);
+    atomic_init(&sim.commandsTail, 0);
+
+    sim.writing = 0;
+    sim.reading = 1;
+    atomic_init(&sim.published, 2);
+
+    atomic_init(&sim.running, true);
+
+    int error = pthread_create(&sim.thread, NULL, simLoop, NULL);
+    assert(error == 0);
+}
+
+void simThread_stop() {
+    atomic_store(&sim.running, false);
+    pthread_join(sim.thread, NULL);
+}
+
+/// Queues a command for the sim thread. Only the thread that started it can push
+void simThread_push(SimCommand command) {
+    int tail = atomic_load(&sim.commandsTail);
+
+    // full: the sim thread empties it every step
+    while (tail - atomic_load(&sim.commandsHead) == SIM_THREAD_COMMAND_CAPACITY) {
+        sched_yield();
+    }
+
+    sim.commands[tail % SIM_THREAD_COMMAND_CAPACITY] = command;
+    atomic_store(&sim.commandsTail, tail + 1);
+}
+
+void simThread_pushGardenCommand(GardenCommand command) {
+    simThread_push((SimCommand){SIM_COMMAND_GARDEN, {.garden = command}});
+}
+
+/// Copies the plants of the last snapshot published into `garden`, and its clock into `clock`.
+/// Returns false (and changes nothing) if it was already read
+bool simThread_readSnapshot(Garden *garden, GameClock *clock) {
+    if ((atomic_load(&sim.published) & SNAPSHOT_FRESH) == 0) {
+        return false;
+    }
+
+    sim.reading = atomic_exchange(&sim.published, sim.reading) & ~SNAPSHOT_FRESH;
+
+    const SimSnapshot *snapshot = &sim.snapshots[sim.reading];
+
+    garden_readSnapshot(garden, &snapshot->garden);
+    *clock = snapshot->clock;
+
+    return true;
+}
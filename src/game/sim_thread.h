@@ -0,0 +1,43 @@
+#pragma once
+
+#include "../entity/garden.h"
+#include "game_clock.h"
+#include "gameplay.h"
+#include <stdbool.h>
+
+// The plant simulation runs on its own thread, on its own copy of the garden. The thread that
+// draws never waits for it: it reads the last snapshot published (simThread_readSnapshot) and sends
+// whatever the player does to the plants as commands
+
+/// seconds between the steps of the simulation
+#define SIM_THREAD_STEP_SECONDS (1.0 / 120)
+/// most of a step the simulation can work, so a time-lapse too fast for the machine slows down
+/// instead of taking the whole thread
+#define SIM_THREAD_STEP_BUDGET_SECONDS (SIM_THREAD_STEP_SECONDS / 2)
+#define SIM_THREAD_COMMAND_CAPACITY 256
+
+typedef enum {
+    /// runs a GardenCommand on the garden of the sim thread
+    SIM_COMMAND_GARDEN,
+    SIM_COMMAND_SET_VIEW,
+    SIM_COMMAND_SET_SPEED,
+    SIM_COMMAND_SET_PAUSED,
+} SimCommandType;
+
+typedef union {
+    GardenCommand garden;
+    GardenView view;
+    GameplaySpeed speed;
+    bool paused;
+} SimCommandArgs;
+
+typedef struct {
+    SimCommandType type;
+    SimCommandArgs args;
+} SimCommand;
+
+void simThread_start(const Garden *garden, const GameClock *clock);
+void simThread_stop();
+void simThread_push(SimCommand command);
+void simThread_pushGardenCommand(GardenCommand command);
+bool simThread_readSnapshot(Garden *garden, GameClock *clock);
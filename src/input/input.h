@@ -1,6 +1,6 @@
 #pragma once
 
-#include <raylib.h>
+#include "../utils/raylib_types.h"
 
 typedef enum {
     MOUSE_BUTTON_STATE_UP,
@@ -1,4 +1,5 @@
 #include "key_map.h"
+#include "../entity/garden.h"
 #include "../game/gameplay.h"
 #include "../utils/utils.h"
 #include "input.h"
@@ -38,6 +39,8 @@ void keyMap_init(KeyMap *keyMap) {
     registerCommand(keyMap, KEY_R, toolSelectionCommands[GARDENING_TOOL_TRASH_BIN]);
     registerCommand(keyMap, KEY_W, toolSelectionCommands[GARDENING_TOOL_IRRIGATOR]);
     registerCommand(keyMap, KEY_F, toolSelectionCommands[GARDENING_TOOL_NUTRIENTS]);
+    registerCommand(keyMap, KEY_P, toolSelectionCommands[GARDENING_TOOL_PRUNER]);
+    registerCommand(keyMap, KEY_I, toolSelectionCommands[GARDENING_TOOL_IRRIGATION]);
 
     registerCommand(keyMap, KEY_ESCAPE, toolSelectionCommands[GARDENING_TOOL_NONE]);
 
@@ -48,6 +51,11 @@ void keyMap_init(KeyMap *keyMap) {
     registerCommand(keyMap, KEY_ZERO, (Message){MESSAGE_CMD_VIEW_ZOOM_RESET});
     registerCommand(keyMap, KEY_GRAVE, (Message){MESSAGE_CMD_VIEW_ROTATE});
     registerCommand(keyMap, KEY_T, (Message){MESSAGE_CMD_TOOL_VARIANT_ROTATE});
+
+    const MessageType inNeed = MESSAGE_CMD_PLANT_IN_NEED_SELECT_NEXT;
+    registerCommand(keyMap, KEY_D, (Message){inNeed, {.selection = GARDEN_NEED_WATER}});
+    registerCommand(keyMap, KEY_N, (Message){inNeed, {.selection = GARDEN_NEED_NUTRIENTS}});
+    registerCommand(keyMap, KEY_H, (Message){inNeed, {.selection = GARDEN_NEED_HEALTH}});
 }
 
 Message keyMap_processInput(KeyMap *keyMap, InputManager *input) {
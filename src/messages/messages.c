@@ -2,6 +2,7 @@
 #include "../core/asset_manager.h"
 #include "../entity/garden.h"
 #include "../game/game.h"
+#include "../game/sim_thread.h"
 #include "../input/input.h"
 #include <assert.h>
 #include <stdio.h>
@@ -119,6 +120,9 @@ static bool addPlanterToSelectedTile(Garden *garden, PlanterType planterType) {
         }
     }
 
+    simThread_pushGardenCommand(
+        (GardenCommand){GARDEN_COMMAND_SET_PLANTER, {.planter = {planterIndex, *p}}});
+
     return true;
 }
 
@@ -178,6 +182,9 @@ static bool movePlanter(Garden *garden, int planterIndex, int destinationTileInd
 
     assert(rotationBefore == rotationAfter);
 
+    simThread_pushGardenCommand(
+        (GardenCommand){GARDEN_COMMAND_SET_PLANTER, {.planter = {planterIndex, *planter}}});
+
     return true;
 }
 
@@ -200,13 +207,15 @@ static void removeFromTile(Garden *garden, Vector2 worldMousePos) {
 
         int plantIndex = planter_getPlantIndexFromWorldPos(planter, planterOrigin, worldMousePos);
 
-        Plant *plant = &planter->plants[plantIndex];
-
-        if (plant->exists) {
-            plant->exists = false;
+        if (plantIndex != -1 && garden_getPlant(garden, planterIndex, plantIndex).exists) {
+            simThread_pushGardenCommand((GardenCommand){
+                GARDEN_COMMAND_REMOVE_PLANT, {.plant = {planterIndex, plantIndex}}});
         } else {
             // TODO: do something if clicked on planter with plants, but in a empty plant space?
-            planter->exists = false;
+            // the plants go away with the next snapshot, the planter right now
+            GardenCommandArgs args = {.planter = {.planterIndex = planterIndex}};
+            simThread_pushGardenCommand((GardenCommand){GARDEN_COMMAND_REMOVE_PLANTER, args});
+            garden_removePlanter(garden, planterIndex);
 
             Vector2 oldDimensions = planter_getFootPrint(planter->type, planter->rotation);
             Vector2 oldEnd = (Vector2){
@@ -252,11 +261,14 @@ static void addPlantToSelectedPlanter(Garden *garden, Vector2 worldMousePos, enu
 
     int plantIndex = planter_getPlantIndexFromWorldPos(planter, planterOrigin, worldMousePos);
 
-    Plant *plant = &planter->plants[plantIndex];
-
-    if (!plant->exists) {
-        planter_addPlant(planter, plantIndex, type);
+    if (plantIndex == -1) {
+        return;
     }
+
+    int planterIndex = garden->tiles[garden->tileSelected].planterIndex;
+
+    simThread_pushGardenCommand((GardenCommand){
+        GARDEN_COMMAND_PROPAGATE_PLANT, {.plant = {planterIndex, plantIndex, type}}});
 }
 
 static void irrigateSelectedPlant(Garden *garden) {
@@ -266,13 +278,15 @@ static void irrigateSelectedPlant(Garden *garden) {
         return;
     }
 
+    int planterIndex = garden->tiles[garden->tileSelected].planterIndex;
     int plantIndex = garden->planterTileHovered;
 
-    Plant *plant = &planter->plants[plantIndex];
-
-    if (plant->exists) {
-        plant_irrigate(plant);
+    if (plantIndex == -1) {
+        return;
     }
+
+    simThread_pushGardenCommand(
+        (GardenCommand){GARDEN_COMMAND_IRRIGATE_PLANT, {.plant = {planterIndex, plantIndex}}});
 }
 
 static void feedSelectedPlant(Garden *garden) {
@@ -284,16 +298,99 @@ static void feedSelectedPlant(Garden *garden) {
 
     Vector2 tileCoords = grid_getCoordsFromTileIndex(GARDEN_COLS, garden->tileSelected);
 
+    int planterIndex = garden->tiles[garden->tileSelected].planterIndex;
     int plantIndex = planter_getPlantIndexFromGridCoords(planter, tileCoords);
-    Plant *plant = &planter->plants[plantIndex];
 
-    if (plant->exists) {
-        plant_feed(plant);
+    if (plantIndex == -1) {
+        return;
+    }
+
+    simThread_pushGardenCommand(
+        (GardenCommand){GARDEN_COMMAND_FEED_PLANT, {.plant = {planterIndex, plantIndex}}});
+}
+
+/// Waters or feeds what the brush of the tool reaches around the tile selected. Everything but a
+/// single plant goes to the sim as one command with all the planters reached
+static void careForSelection(Game *g, GardenCare care) {
+    Garden *garden = &g->garden;
+    enum GardeningTool tool
+        = care == GARDEN_CARE_IRRIGATE ? GARDENING_TOOL_IRRIGATOR : GARDENING_TOOL_NUTRIENTS;
+    CareBrush brush = g->toolVariantsSelection[tool];
+
+    if (brush == CARE_BRUSH_PLANT) {
+        if (care == GARDEN_CARE_IRRIGATE) {
+            irrigateSelectedPlant(garden);
+        } else {
+            feedSelectedPlant(garden);
+        }
+
+        return;
+    }
+
+    GardenCommandArgs args = {.care = {.care = care}};
+
+    if (brush == CARE_BRUSH_PLANTER) {
+        if (!garden_hasPlanterSelected(garden)) {
+            return;
+        }
+
+        int planterIndex = garden->tiles[garden->tileSelected].planterIndex;
+        garden_addPlanterToMask(&args.care.planters, planterIndex);
+    } else {
+        Vector2 coords = grid_getCoordsFromTileIndex(GARDEN_COLS, garden->tileSelected);
+        GardenArea area = {coords.x, coords.y, CARE_BRUSH_RADIUS, brush == CARE_BRUSH_CIRCLE};
+
+        garden_getPlantersInArea(garden, area, &args.care.planters);
     }
+
+    simThread_pushGardenCommand((GardenCommand){GARDEN_COMMAND_CARE_FOR_PLANTERS, args});
+}
+
+static void pruneHoveredPlant(Garden *garden, Vector2 worldMousePos) {
+    Planter *planter = garden_getSelectedPlanter(garden);
+
+    if (planter == NULL || !planter->exists) {
+        return;
+    }
+
+    Vector2 planterOrigin
+        = grid_getTileOrigin(&SCENE_TRANSFORM, planter->coords, TILE_WIDTH, TILE_HEIGHT);
+
+    int plantIndex = planter_getPlantIndexFromWorldPos(planter, planterOrigin, worldMousePos);
+
+    if (plantIndex == -1) {
+        return;
+    }
+
+    int planterIndex = garden->tiles[garden->tileSelected].planterIndex;
+
+    simThread_pushGardenCommand(
+        (GardenCommand){GARDEN_COMMAND_PRUNE_PLANT, {.plant = {planterIndex, plantIndex}}});
+}
+
+/// Lays the piece of the irrigation selected on the tile selected, or takes it away if it is the
+/// one already there
+static void layIrrigationPiece(Game *g) {
+    Garden *garden = &g->garden;
+    IrrigationPiece piece = g->toolVariantsSelection[GARDENING_TOOL_IRRIGATION];
+    Vector2 coords = grid_getCoordsFromTileIndex(GARDEN_COLS, garden->tileSelected);
+
+    if (irrigationNetwork_getPiece(&garden->irrigation, coords.x, coords.y) == piece) {
+        piece = IRRIGATION_PIECE_NONE;
+    }
+
+    // solved here too for the flows drawn, the sim solves its own
+    garden_setIrrigationPiece(garden, coords.x, coords.y, piece);
+    irrigationNetwork_solve(&garden->irrigation);
+
+    GardenCommandArgs args = {.irrigation = {coords.x, coords.y, piece}};
+    simThread_pushGardenCommand((GardenCommand){GARDEN_COMMAND_SET_IRRIGATION_PIECE, args});
 }
 
 static void changeTool(Game *g, enum GardeningTool tool) {
     g->toolSelected = tool;
+    g->gameplayMode
+        = tool == GARDENING_TOOL_IRRIGATION ? GAMEPLAY_MODE_IRRIGATION : GAMEPLAY_MODE_NORMAL;
     g->ui.toolSelectionButtonPannel.activeButtonIndex = g->toolSelected;
 
     // resets
@@ -332,11 +429,11 @@ static void onTileClicked(Game *game, int tileIndex) {
 
     switch (game->toolSelected) {
     case GARDENING_TOOL_IRRIGATOR:
-        irrigateSelectedPlant(&game->garden);
+        careForSelection(game, GARDEN_CARE_IRRIGATE);
         break;
 
     case GARDENING_TOOL_NUTRIENTS:
-        feedSelectedPlant(&game->garden);
+        careForSelection(game, GARDEN_CARE_FEED);
         break;
 
     case GARDENING_TOOL_PLANTER:
@@ -353,6 +450,14 @@ static void onTileClicked(Game *game, int tileIndex) {
         removeFromTile(&game->garden, game->input.worldMousePos);
         break;
 
+    case GARDENING_TOOL_PRUNER:
+        pruneHoveredPlant(&game->garden, game->input.worldMousePos);
+        break;
+
+    case GARDENING_TOOL_IRRIGATION:
+        layIrrigationPiece(game);
+        break;
+
     case GARDENING_TOOL_NONE:
         pickupOrSetPlanter(&game->garden);
         break;
@@ -363,9 +468,43 @@ static void onTileClicked(Game *game, int tileIndex) {
     }
 }
 
+/// Selects the planter of the next plant short of `need`, after the ones of the planter selected,
+/// and moves the view to it
+static void selectNextPlantInNeed(Game *g, GardenNeed need) {
+    Garden *garden = &g->garden;
+    int afterPlantId = -1;
+
+    if (garden->tileSelected != -1 && garden->tiles[garden->tileSelected].planterIndex != -1) {
+        int planterIndex = garden->tiles[garden->tileSelected].planterIndex;
+        afterPlantId = garden_getPlantId(planterIndex, PLANTER_MAX_PLANTS - 1);
+    }
+
+    int plantId = garden_findNextPlantInNeed(garden, need, afterPlantId);
+
+    if (plantId == -1) {
+        return;
+    }
+
+    Planter *planter = &garden->planters[plantId / PLANTER_MAX_PLANTS];
+
+    garden->tileSelected = grid_getTileIndexFromCoords(
+        GARDEN_COLS, GARDEN_ROWS, planter->coords.x, planter->coords.y);
+
+    Vector2 planterOrigin
+        = grid_getTileOrigin(&SCENE_TRANSFORM, planter->coords, TILE_WIDTH, TILE_HEIGHT);
+    Vector2 delta = {
+        planterOrigin.x - g->screenSize.x / 2,
+        planterOrigin.y - g->screenSize.y / 2,
+    };
+
+    moveView(garden, &g->screenSize, delta);
+}
+
 static void changeGameplaySpeed(Game *g, GameplaySpeed newSpeed) {
     g->gameplaySpeed = newSpeed;
     g->ui.speedSelectionButtonPannel.activeButtonIndex = newSpeed;
+
+    simThread_push((SimCommand){SIM_COMMAND_SET_SPEED, {.speed = newSpeed}});
 }
 
 static void outputMessageInfo(Message m) {
@@ -378,9 +517,11 @@ static void outputMessageInfo(Message m) {
     // output params
     switch (m.type) {
     case MESSAGE_EV_TILE_CLICKED:
+    case MESSAGE_EV_DAY_ENDED:
     case MESSAGE_CMD_TOOL_SELECT:
     case MESSAGE_CMD_TOOL_VARIANT_SELECT:
     case MESSAGE_CMD_GAMEPLAY_SPEED_CHANGE:
+    case MESSAGE_CMD_PLANT_IN_NEED_SELECT_NEXT:
         printf("    [args.selection]: %d\n", m.args.selection);
         break;
 
@@ -448,10 +589,18 @@ bool messages_dispatchMessage(Message msg, Game *g) {
         rotateSelection(&g->garden);
         break;
 
+    case MESSAGE_CMD_PLANT_IN_NEED_SELECT_NEXT:
+        selectNextPlantInNeed(g, msg.args.selection);
+        break;
+
     case MESSAGE_EV_UI_CLICKED:
         // fallback
         break;
 
+    case MESSAGE_EV_DAY_ENDED:
+        // nothing happens at the end of a day yet
+        break;
+
     case MESSAGE_NONE:
         return false;
     }
@@ -1,6 +1,6 @@
 #pragma once
 
-#include <raylib.h>
+#include "../utils/raylib_types.h"
 #include <stdbool.h>
 typedef struct Game Game;
 
@@ -11,6 +11,8 @@ typedef enum {
     /// Fallback for ui elements that are not interactive, to stop event propagation
     MESSAGE_EV_UI_CLICKED,
     MESSAGE_EV_TILE_CLICKED,
+    /// once per game day, with the day that ended as `selection`
+    MESSAGE_EV_DAY_ENDED,
 
     // commands
     MESSAGE_CMD_TOOL_SELECT,
@@ -23,6 +25,8 @@ typedef enum {
     MESSAGE_CMD_VIEW_ZOOM_DOWN,
     MESSAGE_CMD_VIEW_ZOOM_RESET,
     MESSAGE_CMD_TOOL_VARIANT_ROTATE,
+    /// selects the planter of the next plant short of the GardenNeed in `selection`
+    MESSAGE_CMD_PLANT_IN_NEED_SELECT_NEXT,
 } MessageType;
 
 // used to have more members and will probably will have more members eventually
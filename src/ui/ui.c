@@ -13,6 +13,8 @@ Rectangle getToolVariantSpriteSourceRec(enum GardeningTool tool, int toolVariant
     case GARDENING_TOOL_NONE:
     case GARDENING_TOOL_IRRIGATOR:
     case GARDENING_TOOL_NUTRIENTS:
+    case GARDENING_TOOL_PRUNER:
+    case GARDENING_TOOL_IRRIGATION:
     case GARDENING_TOOL_COUNT:
         return (Rectangle){};
 
@@ -26,6 +28,20 @@ Rectangle getToolVariantSpriteSourceRec(enum GardeningTool tool, int toolVariant
     return (Rectangle){};
 }
 
+static const char *careBrushLabels[CARE_BRUSH_COUNT] = {
+    [CARE_BRUSH_PLANT] = "Plant",
+    [CARE_BRUSH_PLANTER] = "Planter",
+    [CARE_BRUSH_SQUARE] = "Square",
+    [CARE_BRUSH_CIRCLE] = "Circle",
+};
+
+static const char *irrigationPieceLabels[IRRIGATION_PIECE_COUNT] = {
+    [IRRIGATION_PIECE_NONE] = "Remove",
+    [IRRIGATION_PIECE_PIPE] = "Pipe",
+    [IRRIGATION_PIECE_DRIPPER] = "Dripper",
+    [IRRIGATION_PIECE_TAP] = "Tap",
+};
+
 void ui_syncToolVariantPanelToSelection(
     UI *ui, enum GardeningTool toolSelected, int toolVariantSelected) {
 
@@ -33,16 +49,27 @@ void ui_syncToolVariantPanelToSelection(
 
     int maxVariants;
     Texture2D variantTexture;
+    const char **labels = NULL;
 
     switch (toolSelected) {
     case GARDENING_TOOL_TRASH_BIN:
     case GARDENING_TOOL_NONE:
-    case GARDENING_TOOL_IRRIGATOR:
-    case GARDENING_TOOL_NUTRIENTS:
+    case GARDENING_TOOL_PRUNER:
     case GARDENING_TOOL_COUNT:
         ui->showToolVariantPanel = false;
         return;
 
+    case GARDENING_TOOL_IRRIGATOR:
+    case GARDENING_TOOL_NUTRIENTS:
+        maxVariants = CARE_BRUSH_COUNT;
+        labels = careBrushLabels;
+        break;
+
+    case GARDENING_TOOL_IRRIGATION:
+        maxVariants = IRRIGATION_PIECE_COUNT;
+        labels = irrigationPieceLabels;
+        break;
+
     case GARDENING_TOOL_PLANTER:
         maxVariants = PLANTER_TYPE_COUNT;
         variantTexture = planterAtlas;
@@ -60,9 +87,15 @@ void ui_syncToolVariantPanelToSelection(
     variantGrid->rows = 1;
 
     for (int i = 0; i < maxVariants; i++) {
-        variantGrid->buttons[i].content = (ButtonContent){
-            .icon = {variantTexture, getToolVariantSpriteSourceRec(toolSelected, i)},
-        };
+        if (labels != NULL) {
+            variantGrid->buttons[i].type = BUTTON_TYPE_TEXT_LABEL;
+            variantGrid->buttons[i].content = (ButtonContent){.label = labels[i]};
+        } else {
+            variantGrid->buttons[i].type = BUTTON_TYPE_SPRITE;
+            variantGrid->buttons[i].content = (ButtonContent){
+                .icon = {variantTexture, getToolVariantSpriteSourceRec(toolSelected, i)},
+            };
+        }
 
         if (i == toolVariantSelected) {
             variantGrid->activeButtonIndex = i;
@@ -85,6 +118,12 @@ void ui_init(UI *ui, Vector2 *screenSize, GameplaySpeed gameplaySpeed) {
 
     ui->showToolVariantPanel = false;
 
+    for (int i = 0; i < UI_PLANT_FORECAST_CACHE_SIZE; i++) {
+        ui->plantForecasts[i].plantId = -1;
+    }
+
+    ui->plantForecastNext = 0;
+
     UIButtonGrid *toolGrid = &ui->toolSelectionButtonPannel;
 
     uiButtonGrid_init(toolGrid,
@@ -133,6 +172,14 @@ void ui_init(UI *ui, Vector2 *screenSize, GameplaySpeed gameplaySpeed) {
             bcontent.label = "[R]emove";
             break;
 
+        case GARDENING_TOOL_PRUNER:
+            bcontent.label = "[P]rune";
+            break;
+
+        case GARDENING_TOOL_IRRIGATION:
+            bcontent.label = "[I]rrigation";
+            break;
+
         case GARDENING_TOOL_COUNT:
             continue;
         }
@@ -154,10 +201,19 @@ void ui_init(UI *ui, Vector2 *screenSize, GameplaySpeed gameplaySpeed) {
 
     ui->speedSelectionButtonPannel.activeButtonIndex = gameplaySpeed;
 
+    const char *speedLabels[GAMEPLAY_SPEED_COUNT] = {
+        [GAMEPLAY_SPEED_NORMAL] = ">",
+        [GAMEPLAY_SPEED_FAST] = ">>",
+        [GAMEPLAY_SPEED_FASTEST] = ">>>",
+        [GAMEPLAY_SPEED_TIMELAPSE_100] = "100x",
+        [GAMEPLAY_SPEED_TIMELAPSE_1000] = "1000x",
+        [GAMEPLAY_SPEED_TIMELAPSE_10000] = "10000x",
+    };
+
     for (int i = 0; i < GAMEPLAY_SPEED_COUNT; i++) {
         ui->speedSelectionButtonPannel.buttons[i] = (UIButton){
             .type = BUTTON_TYPE_TEXT_LABEL,
-            .content = {.label = ">"},
+            .content = {.label = speedLabels[i]},
             .command = (Message){MESSAGE_CMD_GAMEPLAY_SPEED_CHANGE, {.selection = i}},
         };
 
@@ -213,12 +269,84 @@ Message ui_processInput(UI *ui, InputManager *input, enum GardeningTool tool) {
     return (Message){MESSAGE_NONE};
 }
 
+/// Writes the game time of `ticks` of a plant of `type` as "3h 20m" or "45m"
+static void formatForecastTicks(char *buffer, int size, enum PlantType type, long ticks) {
+    long gameSeconds
+        = ticks * plantDefinitions[type].secondsPerTick * GAME_SECONDS_PER_RL_SECONDS;
+    long hours = gameSeconds / 60 / 60;
+    long minutes = gameSeconds / 60 % 60;
+
+    if (hours > 0) {
+        snprintf(buffer, size, "%ldh %02ldm", hours, minutes);
+    } else {
+        snprintf(buffer, size, "%ldm", minutes);
+    }
+}
+
+/// Forecast of the plant kept in `ui`, or a place for it that `plant_isForecastOf` says is not
+static PlantForecast *getCachedPlantForecast(UI *ui, int plantId) {
+    for (int i = 0; i < UI_PLANT_FORECAST_CACHE_SIZE; i++) {
+        if (ui->plantForecasts[i].plantId == plantId) {
+            return &ui->plantForecasts[i].forecast;
+        }
+    }
+
+    UIPlantForecast *cached = &ui->plantForecasts[ui->plantForecastNext];
+    ui->plantForecastNext = (ui->plantForecastNext + 1) % UI_PLANT_FORECAST_CACHE_SIZE;
+
+    cached->plantId = plantId;
+    cached->forecast.pointsCount = 0;
+
+    return &cached->forecast;
+}
+
+/// Draws when the plant will need water and be dying, from its cached forecast
+static void drawPlantForecast(UI *ui, UITextBox *tb, int plantId, const Plant *plant) {
+    PlantForecast *forecast = getCachedPlantForecast(ui, plantId);
+
+    if (!plant_isForecastOf(forecast, plant)) {
+        plant_forecast(plant, UI_PLANT_FORECAST_HOURS, forecast);
+    }
+
+    // the forecast can be some ticks old
+    long ticksSinceForecast = plant->ticksCount - forecast->from.ticksCount;
+
+    struct {
+        const char *label;
+        long ticks;
+    } lines[] = {
+        {"Needs water", forecast->ticksToDry},
+        {"Dying", forecast->ticksToDying},
+    };
+
+    char buffer[64];
+    char timeBuffer[32];
+
+    for (int i = 0; i < 2; i++) {
+        long ticksLeft = lines[i].ticks - ticksSinceForecast;
+
+        if (lines[i].ticks == -1) {
+            long ticksForecast = forecast->ticks - ticksSinceForecast;
+
+            formatForecastTicks(timeBuffer, sizeof(timeBuffer), plant->type, ticksForecast);
+            snprintf(buffer, sizeof(buffer), "%s: not in %s", lines[i].label, timeBuffer);
+        } else if (ticksLeft <= 0) {
+            snprintf(buffer, sizeof(buffer), "%s: now", lines[i].label);
+        } else {
+            formatForecastTicks(timeBuffer, sizeof(timeBuffer), plant->type, ticksLeft);
+            snprintf(buffer, sizeof(buffer), "%s in %s", lines[i].label, timeBuffer);
+        }
+
+        uiTextBox_drawTextLine(tb, buffer, BLACK);
+    }
+}
+
 void ui_draw(UI *ui,
     InputManager *input,
     Vector2 *screenSize,
     Garden *garden,
     enum GardeningTool toolSelected,
-    float gameplayTime) {
+    const GameClock *clock) {
 
     int bpFontSize = uiFont.baseSize;
     uiButtonGrid_draw(&ui->toolSelectionButtonPannel, bpFontSize);
@@ -281,6 +409,37 @@ void ui_draw(UI *ui,
         snprintf(buffer, sizeof(buffer), "Light level: %d", lightLevel);
 
         uiTextBox_drawTextLine(&tb, buffer, BLACK);
+
+        snprintf(buffer,
+            sizeof(buffer),
+            "Temperature: %.1f C",
+            temperatureField_get(&garden->temperature, tileCoords.x, tileCoords.y));
+
+        uiTextBox_drawTextLine(&tb, buffer, BLACK);
+
+        snprintf(buffer,
+            sizeof(buffer),
+            "Sun: %.1f h today, %.1f h a day",
+            lightIntegral_getToday(&garden->light, tileCoords.x, tileCoords.y),
+            lightIntegral_getAverage(&garden->light, tileCoords.x, tileCoords.y));
+
+        uiTextBox_drawTextLine(&tb, buffer, BLACK);
+
+        IrrigationPiece piece
+            = irrigationNetwork_getPiece(&garden->irrigation, tileCoords.x, tileCoords.y);
+
+        if (piece == IRRIGATION_PIECE_DRIPPER) {
+            // flows are in half points a second
+            snprintf(buffer,
+                sizeof(buffer),
+                "Dripper: %.1f water/s",
+                irrigationNetwork_getFlow(&garden->irrigation, tileCoords.x, tileCoords.y) / 2.0f);
+
+            uiTextBox_drawTextLine(&tb, buffer, BLACK);
+        } else if (piece != IRRIGATION_PIECE_NONE) {
+            snprintf(buffer, sizeof(buffer), "Irrigation: %s", irrigationPieceLabels[piece]);
+            uiTextBox_drawTextLine(&tb, buffer, BLACK);
+        }
         uiTextBox_drawTextLine(&tb, "", BLACK); // spacing
 
         if (planterIndex != -1 && planter->exists) {
@@ -290,21 +449,35 @@ void ui_draw(UI *ui,
             int plantIndex
                 = planter_getPlantIndexFromWorldPos(planter, planterOrigin, input->worldMousePos);
 
-            const Plant *plant = &planter->plants[plantIndex];
+            Plant plant = {.exists = false};
 
-            if (plantIndex != -1 && plant->exists) {
+            if (plantIndex != -1) {
+                plant = garden_getPlant(garden, planterIndex, plantIndex);
+            }
+
+            if (plant.exists) {
                 uiTextBox_drawTextLine(&tb, "Plant info:", BLACK);
                 tb.cursorPosition.y += 5; // spacing
 
+                char traits[64];
+                snprintf(traits,
+                    sizeof(traits),
+                    "soil %d, food %d, drought %d",
+                    plant.traits.optimalWaterLevel,
+                    plant.traits.optimalNutritionLevel,
+                    plant.traits.droughtResilience);
+
                 struct {
                     const char *label;
                     const char *value;
                 } infoArr[] = {
-                    {"Scientific name", plantDefinitions[plant->type].scientificName},
-                    {"Name", plantDefinitions[plant->type].name},
+                    {"Scientific name", plantDefinitions[plant.type].scientificName},
+                    {"Name", plantDefinitions[plant.type].name},
+                    {"Growth", plant_getGrowthStageName(plant_getGrowthStage(plant.biomass))},
+                    {"Traits", traits},
                 };
 
-                int infoLinesCount = 2;
+                int infoLinesCount = 4;
 
                 tb.cursorPosition.x += 20;
                 for (int i = 0; i < infoLinesCount; i++) {
@@ -322,13 +495,13 @@ void ui_draw(UI *ui,
 
                 struct {
                     const char *label;
-                    float value;
+                    PlantStat value;
                 } stats[] = {
-                    {"Soil Water", plant->mediumHydration},
-                    {"Soil Nutrients", plant->mediumNutrition},
-                    {"Water", plant->hydration},
-                    {"Nutrients", plant->nutrition},
-                    {"Health", plant->health},
+                    {"Soil Water", plant.mediumHydration},
+                    {"Soil Nutrients", plant.mediumNutrition},
+                    {"Water", plant.hydration},
+                    {"Nutrients", plant.nutrition},
+                    {"Health", plant.health},
                 };
 
                 int statsCount = 5;
@@ -339,7 +512,7 @@ void ui_draw(UI *ui,
                     int level = plant_getStatLevel(stats[i].value);
                     int amountByLevel = (100.0f / PLANT_STATUS_LEVEL_COUNT);
                     int baseAmount = amountByLevel * level;
-                    int restOfLevel = stats[i].value - baseAmount;
+                    int restOfLevel = stats[i].value / PLANT_STAT_ONE - baseAmount;
                     int internalWidth = (statBarWitdh / amountByLevel) * restOfLevel;
 
                     DrawRectangleV(
@@ -354,15 +527,28 @@ void ui_draw(UI *ui,
 
                     tb.cursorPosition.y += 5;
                 }
+
+                tb.cursorPosition.y += 16; // spacing
+                drawPlantForecast(ui, &tb, garden_getPlantId(planterIndex, plantIndex), &plant);
             }
         }
     }
 
-    int hours = gameplayTime / 60 / 60;
-    int minutes = (int)gameplayTime / 60 % 60;
-    int seconds = (int)gameplayTime % 60;
-
-    snprintf(buffer, sizeof(buffer), "Time: %02d:%02d:%02d", hours, minutes, seconds);
+    int timeOfDay = gameClock_getTimeOfDay(clock);
+    int hours = timeOfDay / 60 / 60;
+    int minutes = timeOfDay / 60 % 60;
+    int seconds = timeOfDay % 60;
+
+    snprintf(buffer,
+        sizeof(buffer),
+        "Year %lld, %s %d - %02d:%02d:%02d - %s",
+        gameClock_getYear(clock) + 1,
+        gameClock_getSeasonName(gameClock_getSeason(clock)),
+        gameClock_getDayOfSeason(clock) + 1,
+        hours,
+        minutes,
+        seconds,
+        weather_getName(garden->weather.state));
 
     Vector2 clockPos = {
         ui->speedSelectionButtonPannel.origin.x + 20
@@ -372,6 +558,28 @@ void ui_draw(UI *ui,
 
     DrawText(buffer, clockPos.x, clockPos.y, 30, WHITE);
 
+    const PlantStoreStats *plantStats = &garden->plants.stats;
+
+    snprintf(buffer,
+        sizeof(buffer),
+        "%d plants, %d dying, %d dead, %d sick - health %.0f avg",
+        plantStats->count,
+        plantStats->countByHealthLevel[PLANT_HEALTH_LEVEL_DYING],
+        plantStats->countByHealthLevel[PLANT_HEALTH_LEVEL_DEAD],
+        plantStats->infectedCount,
+        plantStore_getAverageStat(plantStats, plantStats->healthSum));
+
+    DrawText(buffer, clockPos.x, clockPos.y + 35, 20, WHITE);
+
+    snprintf(buffer,
+        sizeof(buffer),
+        "Need water: %d [D], nutrients: %d [N], care: %d [H]",
+        garden_countPlantsInNeed(garden, GARDEN_NEED_WATER),
+        garden_countPlantsInNeed(garden, GARDEN_NEED_NUTRIENTS),
+        garden_countPlantsInNeed(garden, GARDEN_NEED_HEALTH));
+
+    DrawText(buffer, clockPos.x, clockPos.y + 60, 20, WHITE);
+
     // Draw cursor at the end
     Texture2D cursorTexture;
 
@@ -396,6 +604,14 @@ void ui_draw(UI *ui,
         cursorTexture = cursorTexture_remove;
         break;
 
+    case GARDENING_TOOL_PRUNER:
+        cursorTexture = cursorTexture_plant;
+        break;
+
+    case GARDENING_TOOL_IRRIGATION:
+        cursorTexture = cursorTexture_water;
+        break;
+
     case GARDENING_TOOL_NONE:
         cursorTexture = cursorTexture_1;
         break;
@@ -1,18 +1,36 @@
 #pragma once
 #include "../entity/garden.h"
+#include "../game/game_clock.h"
 #include "../game/gameplay.h"
 #include "../input/input.h"
 #include "ui_button_grid.h"
 #include <raylib.h>
 #include <stdbool.h>
 
+/// game hours the plant info panel forecasts
+#define UI_PLANT_FORECAST_HOURS 24
+/// plants whose forecasts are kept, so going back to one of the last plants shown doesn't make it
+/// again
+#define UI_PLANT_FORECAST_CACHE_SIZE 4
+
 typedef struct Game Game;
 
+typedef struct {
+    /// -1 for none
+    int plantId;
+    PlantForecast forecast;
+} UIPlantForecast;
+
 typedef struct {
     UIButtonGrid toolSelectionButtonPannel;
     UIButtonGrid toolVariantButtonPannel;
     UIButtonGrid speedSelectionButtonPannel;
     bool showToolVariantPanel;
+    /// last forecast of the last plants shown. Made again only when the plant is not as forecast
+    /// anymore (see plant_isForecastOf). A plant not in them takes the place of the one that got
+    /// in first, `plantForecastNext`
+    UIPlantForecast plantForecasts[UI_PLANT_FORECAST_CACHE_SIZE];
+    int plantForecastNext;
 } UI;
 
 void ui_syncToolVariantPanelToSelection(
@@ -27,4 +45,4 @@ void ui_draw(UI *ui,
     Vector2 *screenSize,
     Garden *garden,
     enum GardeningTool toolSelected,
-    float gameplayTime);
+    const GameClock *clock);
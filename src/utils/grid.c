@@ -160,14 +160,13 @@ Vector2 grid_getDistanceFromFarthestTile(Rotation rotation, int x, int y, int co
 
 int grid_getZIndex(Rotation rotation, int x, int y, int cols, int rows) {
     Vector2 distance = grid_getDistanceFromFarthestTile(rotation, x, y, cols, rows);
-    int localCols;
-    int localRows;
+    // as they are at 0 and 180, swapped when the grid is on its side
+    int localCols = cols;
+    int localRows = rows;
 
     switch (rotation) {
     case ROTATION_180:
     case ROTATION_0:
-        localCols = cols;
-        localRows = rows;
         break;
     case ROTATION_90:
     case ROTATION_270:
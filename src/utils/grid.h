@@ -1,7 +1,7 @@
 #pragma once
 
+#include "raylib_types.h"
 #include "utils.h"
-#include <raylib.h>
 #include <stdbool.h>
 
 // WIP
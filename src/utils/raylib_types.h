@@ -0,0 +1,35 @@
+#pragma once
+
+// The simulation only uses the plain structs of raylib (vectors, rectangles, colors), not raylib
+// itself. With GARDEN_HEADLESS (the libgarden build) they are defined here, the same as raylib
+// defines them, so the simulation builds where raylib is not installed
+#ifdef GARDEN_HEADLESS
+
+typedef struct Vector2 {
+    float x;
+    float y;
+} Vector2;
+
+typedef struct Vector3 {
+    float x;
+    float y;
+    float z;
+} Vector3;
+
+typedef struct Rectangle {
+    float x;
+    float y;
+    float width;
+    float height;
+} Rectangle;
+
+typedef struct Color {
+    unsigned char r;
+    unsigned char g;
+    unsigned char b;
+    unsigned char a;
+} Color;
+
+#else
+#include <raylib.h>
+#endif
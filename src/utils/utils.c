@@ -1,7 +1,7 @@
 #include "utils.h"
 #include "../game/constants.h"
 #include <assert.h>
-#include <raylib.h>
+#include <string.h>
 
 float utils_absf(float f) {
     return f > 0 ? f : -f;
@@ -44,6 +44,12 @@ Rectangle utils_getRotatedRec(Rectangle rec, Rotation rotation) {
     }
 }
 
+/// Same as raylib's CheckCollisionRecs
+bool utils_recsOverlap(Rectangle a, Rectangle b) {
+    return a.x < b.x + b.width && a.x + a.width > b.x && a.y < b.y + b.height
+        && a.y + a.height > b.y;
+}
+
 Rotation utils_rotate(Rotation initialRotation, int steps) {
     Rotation steppedRotation = initialRotation + steps;
     return steppedRotation % ROTATION_COUNT;
@@ -81,3 +87,73 @@ void utils_rotateIsoRec(IsoRec *isoRec, Rotation rotation) {
         }
     }
 }
+
+#define HASH_MULTIPLIER 0x9e3779b97f4a7c15
+#define HASH_LANES 8
+
+static uint64_t mix(uint64_t hash, uint64_t word) {
+    hash = (hash ^ word) * HASH_MULTIPLIER;
+    return hash ^ (hash >> 32);
+}
+
+/// Adds `size` bytes to `hash` (not a cryptographic one, only to tell states apart). The words go
+/// to HASH_LANES independent lanes with a single multiply each, an odd one so a lane can't lose
+/// what it took, and the lanes are mixed at the end
+uint64_t utils_hash(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    uint64_t lanes[HASH_LANES];
+    size_t i = 0;
+
+    for (int lane = 0; lane < HASH_LANES; lane++) {
+        lanes[lane] = hash + lane;
+    }
+
+    for (; i + HASH_LANES * 8 <= size; i += HASH_LANES * 8) {
+        for (int lane = 0; lane < HASH_LANES; lane++) {
+            uint64_t word;
+            memcpy(&word, &bytes[i + lane * 8], 8);
+            lanes[lane] = (lanes[lane] ^ word) * HASH_MULTIPLIER;
+        }
+    }
+
+    for (; i < size; i++) {
+        lanes[0] = mix(lanes[0], bytes[i]);
+    }
+
+    hash = mix(lanes[0], size);
+
+    for (int lane = 1; lane < HASH_LANES; lane++) {
+        hash = mix(hash, lanes[lane]);
+    }
+
+    return hash;
+}
+
+/// Hash of a few words, i.e. the fields of an entry of a hash kept up to date by entry: the hashes
+/// of the entries are XORed together, so an entry is taken out by XORing its hash again. Never 0,
+/// so an entry that is there always counts
+uint64_t utils_hashWords(const uint64_t *words, int count) {
+    uint64_t hash = count;
+
+    for (int i = 0; i < count; i++) {
+        hash = mix(hash, words[i]);
+    }
+
+    // splitmix64 finalizer, every bit of the words moves every bit of the hash
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+    hash ^= hash >> 31;
+
+    return hash != 0 ? hash : 1;
+}
+
+/// Next number of a splitmix64 stream, for the simulations that must give the same numbers every
+/// run from the same `state`
+uint64_t utils_random(uint64_t *state) {
+    uint64_t z = *state += 0x9e3779b97f4a7c15;
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+
+    return z ^ (z >> 31);
+}
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "../game/gameplay.h"
-#include <raylib.h>
+#include "raylib_types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 typedef struct {
     Vector2 translation;
@@ -23,7 +26,15 @@ void utils_rotateVector(Vector2 *vector, Rotation rotation);
 float utils_clampf(float min, float max, float value);
 float utils_absf(float f);
 
+// hashing
+uint64_t utils_hash(uint64_t hash, const void *data, size_t size);
+uint64_t utils_hashWords(const uint64_t *words, int count);
+
+// random numbers
+uint64_t utils_random(uint64_t *state);
+
 // rec and isometric transform utils
 Rectangle utils_getRotatedRec(Rectangle rec, Rotation rotation);
+bool utils_recsOverlap(Rectangle a, Rectangle b);
 Rotation utils_rotate(Rotation initialRotation, int steps);
 void utils_rotateIsoRec(IsoRec *isoRec, Rotation rotation);
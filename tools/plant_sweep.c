@@ -0,0 +1,565 @@
+// Parameter sweep for balancing the plant definitions. Simulates a headless garden for every
+// combination of the given ranges (definition values, genes and care schedule), in parallel on the
+// job pool, and writes the survival and health of each garden as CSV.
+//
+// make sweep
+// ./build/tools/plant_sweep --water-level 0:4 --water-every 5:60:5 --days 60 > sweep.csv
+//
+// Ranges are `min:max[:step]` or a single value. The definition values not given are the ones of
+// the species, and the alleles not given the ones of the wild type (0). Times are game time, as
+// the clock shows it: a game day is SWEEP_SECONDS_IN_A_GAME_DAY seconds of the plants at normal
+// speed. Plants are simulated with plant_advanceTicksWithDefinition, jumping from level change to
+// level change, so a day costs about as much as the times its levels change: about a microsecond
+// for a plant left alone, a hundred for one cared for every couple of game minutes, whose levels
+// change almost every tick. But a plant cared for on a schedule settles in a cycle of it within a
+// few days, and the days after that are taken from the cycle instead of simulated (see
+// simulatePlant), so what costs is how long the plants take to settle (or die), not the days.
+// Each plant of a garden gets the same schedule starting at a random time of the first interval,
+// as the player wouldn't water them all at once.
+// Results don't depend on the amount of workers
+
+#include "../src/core/job_pool.h"
+#include "../src/entity/plant.h"
+#include "../src/entity/plant_genome.h"
+#include "../src/game/gameplay.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SWEEP_MAX_GARDENS 65536
+/// plants live in real seconds (at normal speed), the clock runs GAME_SECONDS_PER_RL_SECONDS
+/// times faster
+#define SWEEP_SECONDS_IN_A_GAME_MINUTE (60 / GAME_SECONDS_PER_RL_SECONDS)
+#define SWEEP_SECONDS_IN_A_GAME_DAY (SECONDS_IN_A_DAY / GAME_SECONDS_PER_RL_SECONDS)
+/// min of a range that takes the value of the species
+#define SWEEP_SPECIES_VALUE -1
+/// species, the two levels, the genes and the two care intervals
+#define SWEEP_RANGE_COUNT (5 + PLANT_GENE_COUNT)
+/// most periods of the care schedule a cycle of a plant is looked for in, see simulatePlant
+#define SWEEP_CYCLE_MAX_PERIODS 8
+/// points of the cycle of a plant whose health is kept
+#define SWEEP_CYCLE_SAMPLES 64
+
+typedef struct {
+    int min;
+    int max;
+    int step;
+} SweepRange;
+
+typedef struct {
+    SweepRange species;
+    SweepRange waterLevel;
+    SweepRange nutrientsLevel;
+    /// alleles of each PlantGene, see plant_genome.h
+    SweepRange genes[PLANT_GENE_COUNT];
+    /// 0 is never
+    SweepRange waterEveryMinutes;
+    /// 0 is never
+    SweepRange feedEveryMinutes;
+    int days;
+    int plants;
+    unsigned int seed;
+} SweepOptions;
+
+typedef struct {
+    int species;
+    PlantDefinition definition;
+    PlantGenome genome;
+    int waterEveryMinutes;
+    int feedEveryMinutes;
+
+    int survivors;
+    /// of the health at the end of each day simulated, in points
+    double dailyHealthSum;
+    long dailyHealthCount;
+    double finalHealthSum;
+    float minFinalHealth;
+    long deathDaySum;
+} SweepGarden;
+
+typedef struct {
+    const SweepOptions *options;
+    SweepGarden *gardens;
+} SweepContext;
+
+static SweepGarden gardens[SWEEP_MAX_GARDENS];
+
+static double now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned int randomNumber(unsigned int *seed) {
+    *seed = *seed * 1103515245 + 12345;
+
+    return *seed >> 8;
+}
+
+static int getRangeCount(const SweepRange *range) {
+    return range->min == SWEEP_SPECIES_VALUE ? 1 : (range->max - range->min) / range->step + 1;
+}
+
+/// Value `index` of the range, or `speciesValue` if the range wasn't given
+static int getRangeValue(const SweepRange *range, int index, int speciesValue) {
+    return range->min == SWEEP_SPECIES_VALUE ? speciesValue : range->min + index * range->step;
+}
+
+/// Ranges of the sweep, in the order the gardens go through them (the last one first)
+static int getRanges(const SweepOptions *options, const SweepRange **ranges) {
+    int count = 0;
+
+    ranges[count++] = &options->species;
+    ranges[count++] = &options->waterLevel;
+    ranges[count++] = &options->nutrientsLevel;
+
+    for (int gene = 0; gene < PLANT_GENE_COUNT; gene++) {
+        ranges[count++] = &options->genes[gene];
+    }
+
+    ranges[count++] = &options->waterEveryMinutes;
+    ranges[count++] = &options->feedEveryMinutes;
+
+    return count;
+}
+
+/// Sets up garden `index` of the sweep, counting the ranges from the last one
+static void setupGarden(const SweepOptions *options, int index, SweepGarden *garden) {
+    const SweepRange *ranges[SWEEP_RANGE_COUNT];
+    const int rangeCount = getRanges(options, ranges);
+    int valueIndexes[SWEEP_RANGE_COUNT];
+
+    for (int i = rangeCount - 1; i >= 0; i--) {
+        valueIndexes[i] = index % getRangeCount(ranges[i]);
+        index /= getRangeCount(ranges[i]);
+    }
+
+    *garden = (SweepGarden){.minFinalHealth = 100};
+
+    garden->species = getRangeValue(ranges[0], valueIndexes[0], 0);
+
+    PlantDefinition *definition = &garden->definition;
+    *definition = plantDefinitions[garden->species];
+
+    definition->optimalWaterLevel
+        = getRangeValue(ranges[1], valueIndexes[1], definition->optimalWaterLevel);
+    definition->optimalNutrientsLevel
+        = getRangeValue(ranges[2], valueIndexes[2], definition->optimalNutrientsLevel);
+
+    // the wild type has all the alleles at 0
+    for (int gene = 0; gene < PLANT_GENE_COUNT; gene++) {
+        int allele = getRangeValue(ranges[3 + gene], valueIndexes[3 + gene], 0);
+
+        garden->genome |= allele << (gene * PLANT_GENE_BITS);
+    }
+
+    const int care = rangeCount - 2;
+
+    garden->waterEveryMinutes = getRangeValue(ranges[care], valueIndexes[care], 0);
+    garden->feedEveryMinutes = getRangeValue(ranges[care + 1], valueIndexes[care + 1], 0);
+}
+
+/// First time of a schedule of `interval` seconds, somewhere in the first interval
+static long long getFirstCareTime(long long interval, unsigned int *seed) {
+    return interval == 0 ? LLONG_MAX : randomNumber(seed) % interval;
+}
+
+/// A plant of a garden, and when it is cared for next
+typedef struct {
+    Plant plant;
+    long ticksDone;
+    long long nextWater;
+    long long nextFeed;
+} SweepPlant;
+
+/// What the health of a plant is at a point of its cycle, see simulatePlant
+typedef struct {
+    long long offset;
+    PlantStat health;
+} SweepCycleSample;
+
+static long long getGreatestCommonDivisor(long long a, long long b) {
+    while (b != 0) {
+        long long rest = a % b;
+        a = b;
+        b = rest;
+    }
+
+    return a;
+}
+
+static long long getLeastCommonMultiple(long long a, long long b) {
+    return a / getGreatestCommonDivisor(a, b) * b;
+}
+
+/// Seconds after which the care of the garden starts over, in whole ticks of the plants. 0 if
+/// the plants are left alone
+static long long getCarePeriod(const SweepGarden *garden) {
+    const long long waterInterval = garden->waterEveryMinutes * SWEEP_SECONDS_IN_A_GAME_MINUTE;
+    const long long feedInterval = garden->feedEveryMinutes * SWEEP_SECONDS_IN_A_GAME_MINUTE;
+
+    if (waterInterval == 0 && feedInterval == 0) {
+        return 0;
+    }
+
+    long long period = waterInterval == 0 ? feedInterval
+                     : feedInterval == 0  ? waterInterval
+                                          : getLeastCommonMultiple(waterInterval, feedInterval);
+
+    // a tick is a multiple of 1/128 seconds, so whole ticks fit in multiples of `tickSeconds`
+    long long tickUnits = garden->definition.secondsPerTick * 128;
+    long long tickSeconds = tickUnits / getGreatestCommonDivisor(tickUnits, 128);
+
+    return getLeastCommonMultiple(period, tickSeconds);
+}
+
+/// Simulates the plant until `time` (in seconds since it was planted), with the care before it.
+/// The care due at `time` is left for later, as the health of a day is taken before it
+static void advancePlant(SweepPlant *p, const SweepGarden *garden, long long time) {
+    const PlantDefinition *props = &garden->definition;
+    const long long waterInterval = garden->waterEveryMinutes * SWEEP_SECONDS_IN_A_GAME_MINUTE;
+    const long long feedInterval = garden->feedEveryMinutes * SWEEP_SECONDS_IN_A_GAME_MINUTE;
+
+    while (true) {
+        long long next = time;
+        next = p->nextWater < next ? p->nextWater : next;
+        next = p->nextFeed < next ? p->nextFeed : next;
+
+        long ticks = next / props->secondsPerTick;
+        plant_advanceTicksWithDefinition(&p->plant, props, ticks - p->ticksDone);
+        p->ticksDone = ticks;
+
+        if (next == time) {
+            return;
+        }
+
+        if (next == p->nextWater) {
+            plant_irrigate(&p->plant);
+            p->nextWater += waterInterval;
+        }
+
+        if (next == p->nextFeed) {
+            plant_feed(&p->plant);
+            p->nextFeed += feedInterval;
+        }
+    }
+}
+
+/// Whether the rules see `a` and `b` the same: the biomass and the ticks don't change any of them
+static bool isSameForTheRules(const Plant *a, const Plant *b) {
+    return a->mediumHydration == b->mediumHydration && a->mediumNutrition == b->mediumNutrition
+        && a->hydration == b->hydration && a->nutrition == b->nutrition && a->health == b->health;
+}
+
+/// Health of the plant `offset` seconds into the cycle that starts with `cycle`, at `cycleTime`
+static PlantStat getCycleHealth(const SweepPlant *cycle,
+    long long cycleTime,
+    long long offset,
+    const SweepGarden *garden,
+    SweepCycleSample *samples,
+    int *samplesCount) {
+    for (int i = 0; i < *samplesCount; i++) {
+        if (samples[i].offset == offset) {
+            return samples[i].health;
+        }
+    }
+
+    SweepPlant p = *cycle;
+    advancePlant(&p, garden, cycleTime + offset);
+
+    if (*samplesCount < SWEEP_CYCLE_SAMPLES) {
+        samples[(*samplesCount)++] = (SweepCycleSample){offset, p.plant.health};
+    }
+
+    return p.plant.health;
+}
+
+/// A plant cared for on a schedule ends up going round a cycle of a few periods of the schedule:
+/// once it is back where it was some periods before, with the care due at the same times, it will
+/// go round them forever. From there the health at the end of each day is the one at the same
+/// point of the cycle, and the days left cost a lookup. Plants often get there within a day or a
+/// few, and the stats are integers, so it is exactly what simulating the days would give
+static void simulatePlant(SweepGarden *garden, int days, unsigned int *seed) {
+    const long long waterInterval = garden->waterEveryMinutes * SWEEP_SECONDS_IN_A_GAME_MINUTE;
+    const long long feedInterval = garden->feedEveryMinutes * SWEEP_SECONDS_IN_A_GAME_MINUTE;
+    const long long period = getCarePeriod(garden);
+
+    SweepPlant p = {0};
+    plant_initWithGenome(&p.plant, garden->species, garden->genome);
+    p.plant.traits = plantGenome_express(p.plant.genome, &garden->definition);
+    p.nextWater = getFirstCareTime(waterInterval, seed);
+    p.nextFeed = getFirstCareTime(feedInterval, seed);
+
+    // the plant at the start of each of the last periods, in a ring by period, until it is at the
+    // start of one of them again. Then the cycle is the periods since
+    Plant periodStarts[SWEEP_CYCLE_MAX_PERIODS];
+    long long periods = 0;
+    long long cycleLength = 0;
+    SweepCycleSample samples[SWEEP_CYCLE_SAMPLES];
+    int samplesCount = 0;
+    PlantStat health = p.plant.health;
+
+    periodStarts[0] = p.plant;
+
+    for (int day = 1; day <= days; day++) {
+        const long long dayTime = day * (long long)SWEEP_SECONDS_IN_A_GAME_DAY;
+
+        while (period != 0 && cycleLength == 0 && (periods + 1) * period <= dayTime) {
+            periods++;
+            advancePlant(&p, garden, periods * period);
+
+            for (int back = 1; back <= SWEEP_CYCLE_MAX_PERIODS && back <= periods; back++) {
+                const Plant *start = &periodStarts[(periods - back) % SWEEP_CYCLE_MAX_PERIODS];
+
+                if (isSameForTheRules(&p.plant, start)) {
+                    cycleLength = back * period;
+                    break;
+                }
+            }
+
+            // in place of the one of SWEEP_CYCLE_MAX_PERIODS periods ago, already compared
+            periodStarts[periods % SWEEP_CYCLE_MAX_PERIODS] = p.plant;
+        }
+
+        if (cycleLength != 0) {
+            // `p` stays at the start of the cycle
+            long long cycleTime = periods * period;
+            long long offset = (dayTime - cycleTime) % cycleLength;
+            health = getCycleHealth(&p, cycleTime, offset, garden, samples, &samplesCount);
+        } else {
+            advancePlant(&p, garden, dayTime);
+            health = p.plant.health;
+        }
+
+        garden->dailyHealthSum += (float)health / PLANT_STAT_ONE;
+        garden->dailyHealthCount++;
+
+        // dead plants don't come back
+        if (plant_getStatLevel(health) == PLANT_HEALTH_LEVEL_DEAD) {
+            garden->deathDaySum += day;
+            break;
+        }
+
+        if (day == days) {
+            garden->survivors++;
+        }
+    }
+
+    float finalHealth = (float)health / PLANT_STAT_ONE;
+
+    garden->finalHealthSum += finalHealth;
+
+    if (finalHealth < garden->minFinalHealth) {
+        garden->minFinalHealth = finalHealth;
+    }
+}
+
+static void simulateGardensJob(void *context, int first, int count) {
+    const SweepContext *sweep = context;
+
+    for (int i = first; i < first + count; i++) {
+        SweepGarden *garden = &sweep->gardens[i];
+        unsigned int seed = sweep->options->seed ^ (i * 2654435761u);
+
+        setupGarden(sweep->options, i, garden);
+
+        for (int plant = 0; plant < sweep->options->plants; plant++) {
+            simulatePlant(garden, sweep->options->days, &seed);
+        }
+    }
+}
+
+static void writeCsv(FILE *file, const SweepOptions *options, int gardenCount) {
+    fprintf(file,
+        "species,optimal_water_level,optimal_nutrients_level,water_level_allele,"
+        "nutrition_level_allele,drought_resilience_allele,water_every_minutes,"
+        "feed_every_minutes,plants,days,survival,mean_daily_health,mean_final_health,"
+        "min_final_health,mean_death_day\n");
+
+    for (int i = 0; i < gardenCount; i++) {
+        const SweepGarden *garden = &gardens[i];
+        const PlantDefinition *definition = &garden->definition;
+        int deaths = options->plants - garden->survivors;
+
+        fprintf(file,
+            "%s,%d,%d,%d,%d,%d,%d,%d,%d,%d,%.4f,%.2f,%.2f,%.2f,",
+            plantDefinitions[garden->species].name,
+            definition->optimalWaterLevel,
+            definition->optimalNutrientsLevel,
+            plantGenome_getAllele(garden->genome, PLANT_GENE_WATER_LEVEL),
+            plantGenome_getAllele(garden->genome, PLANT_GENE_NUTRITION_LEVEL),
+            plantGenome_getAllele(garden->genome, PLANT_GENE_DROUGHT_RESILIENCE),
+            garden->waterEveryMinutes,
+            garden->feedEveryMinutes,
+            options->plants,
+            options->days,
+            (double)garden->survivors / options->plants,
+            garden->dailyHealthSum / garden->dailyHealthCount,
+            garden->finalHealthSum / options->plants,
+            garden->minFinalHealth);
+
+        if (deaths > 0) {
+            fprintf(file, "%.2f\n", (double)garden->deathDaySum / deaths);
+        } else {
+            fprintf(file, "\n");
+        }
+    }
+}
+
+static bool parseRange(const char *text, SweepRange *range) {
+    int read = sscanf(text, "%d:%d:%d", &range->min, &range->max, &range->step);
+
+    if (read == 1) {
+        range->max = range->min;
+    }
+
+    if (read < 3) {
+        range->step = 1;
+    }
+
+    return read >= 1 && range->min >= 0 && range->max >= range->min && range->step > 0;
+}
+
+static bool parseGeneRange(const char *text, SweepRange *range) {
+    return parseRange(text, range) && range->max <= PLANT_GENE_MASK;
+}
+
+static void printUsage(const char *program) {
+    fprintf(stderr,
+        "usage: %s [options]\n"
+        "  ranges are min:max[:step] or a single value\n"
+        "  --species RANGE          plant types (default all)\n"
+        "  --water-level RANGE      optimalWaterLevel, 0 to 4\n"
+        "  --nutrients-level RANGE  optimalNutrientsLevel, 0 to 4\n"
+        "  --water-gene RANGE       allele of the optimal water level, 0 to 3 (0 and 1 keep the\n"
+        "                           level of the species, 2 is one level up, 3 one down)\n"
+        "  --nutrition-gene RANGE   allele of the optimal nutrition level, as the water one\n"
+        "  --drought-gene RANGE     allele of the drought resilience, 0 to 3 half points of\n"
+        "                           health a second the plant doesn't lose when dry\n"
+        "  --water-every RANGE      game minutes between irrigations, 0 is never (default 10)\n"
+        "  --feed-every RANGE       game minutes between feedings, 0 is never (default 60)\n"
+        "  --days N                 game days simulated (default 30)\n"
+        "  --plants N               plants per garden (default 100)\n"
+        "  --seed N\n"
+        "  --out FILE               CSV file (default stdout)\n",
+        program);
+}
+
+int main(int argc, char **argv) {
+    SweepOptions options = {
+        .species = {0, PLANT_TYPE_COUNT - 1, 1},
+        .waterLevel = {SWEEP_SPECIES_VALUE},
+        .nutrientsLevel = {SWEEP_SPECIES_VALUE},
+        .genes = {{0, 0, 1}, {0, 0, 1}, {0, 0, 1}},
+        .waterEveryMinutes = {10, 10, 1},
+        .feedEveryMinutes = {60, 60, 1},
+        .days = 30,
+        .plants = 100,
+        .seed = 12345,
+    };
+    const char *outPath = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *option = argv[i];
+        const char *value = i + 1 < argc ? argv[++i] : NULL;
+        bool valid = value != NULL;
+
+        if (!valid) {
+        } else if (strcmp(option, "--species") == 0) {
+            valid = parseRange(value, &options.species)
+                && options.species.max < PLANT_TYPE_COUNT;
+        } else if (strcmp(option, "--water-level") == 0) {
+            valid = parseRange(value, &options.waterLevel) && options.waterLevel.max <= 4;
+        } else if (strcmp(option, "--nutrients-level") == 0) {
+            valid = parseRange(value, &options.nutrientsLevel) && options.nutrientsLevel.max <= 4;
+        } else if (strcmp(option, "--water-gene") == 0) {
+            valid = parseGeneRange(value, &options.genes[PLANT_GENE_WATER_LEVEL]);
+        } else if (strcmp(option, "--nutrition-gene") == 0) {
+            valid = parseGeneRange(value, &options.genes[PLANT_GENE_NUTRITION_LEVEL]);
+        } else if (strcmp(option, "--drought-gene") == 0) {
+            valid = parseGeneRange(value, &options.genes[PLANT_GENE_DROUGHT_RESILIENCE]);
+        } else if (strcmp(option, "--water-every") == 0) {
+            valid = parseRange(value, &options.waterEveryMinutes);
+        } else if (strcmp(option, "--feed-every") == 0) {
+            valid = parseRange(value, &options.feedEveryMinutes);
+        } else if (strcmp(option, "--days") == 0) {
+            options.days = atoi(value);
+            valid = options.days > 0;
+        } else if (strcmp(option, "--plants") == 0) {
+            options.plants = atoi(value);
+            valid = options.plants > 0;
+        } else if (strcmp(option, "--seed") == 0) {
+            options.seed = strtoul(value, NULL, 10);
+        } else if (strcmp(option, "--out") == 0) {
+            outPath = value;
+        } else {
+            valid = false;
+        }
+
+        if (!valid) {
+            fprintf(stderr, "bad option: %s %s\n", option, value ? value : "");
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    const SweepRange *ranges[SWEEP_RANGE_COUNT];
+    const int rangeCount = getRanges(&options, ranges);
+    long gardenCount = 1;
+
+    for (int i = 0; i < rangeCount; i++) {
+        gardenCount *= getRangeCount(ranges[i]);
+
+        if (gardenCount > SWEEP_MAX_GARDENS) {
+            fprintf(stderr, "more than %d gardens, narrow the ranges\n", SWEEP_MAX_GARDENS);
+            return 2;
+        }
+    }
+
+    FILE *file = outPath ? fopen(outPath, "w") : stdout;
+
+    if (file == NULL) {
+        perror(outPath);
+        return 2;
+    }
+
+    SweepContext context = {&options, gardens};
+    double start = now();
+
+    // few enough jobs to fit in the queue, the ones that don't are run before waking the workers
+    int batchSize = (gardenCount + JOB_POOL_QUEUE_CAPACITY - 1) / JOB_POOL_QUEUE_CAPACITY;
+
+    jobPool_init();
+    jobPool_submitRange(simulateGardensJob, &context, gardenCount, batchSize);
+    jobPool_wait();
+
+    double seconds = now() - start;
+    int threads = jobPool_getWorkersCount() + 1;
+    jobPool_shutdown();
+
+    writeCsv(file, &options, gardenCount);
+
+    if (file != stdout) {
+        fclose(file);
+    }
+
+    // dead plants stop being simulated
+    double plantDays = 0;
+
+    for (int i = 0; i < gardenCount; i++) {
+        plantDays += gardens[i].dailyHealthCount;
+    }
+
+    fprintf(stderr,
+        "%ld gardens, %.0f plant-days in %.3f s on %d threads: %.2f M plant-days/s\n",
+        gardenCount,
+        plantDays,
+        seconds,
+        threads,
+        plantDays / seconds / 1e6);
+
+    return 0;
+}